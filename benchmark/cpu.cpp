@@ -0,0 +1,274 @@
+#ifdef __linux__
+
+#include "probe/cpu.h"
+
+#include "probe/defer.h"
+#include "probe/util.h"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <unordered_set>
+
+using namespace probe;
+
+// the line scanners that the single-read cpuinfo_t replaced, each call reads the whole file
+static std::optional<std::string> legacy_cpuinfo_read_first_of(const char *key)
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+
+    if (!cpuinfo.is_open() || !cpuinfo) return std::nullopt;
+
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.find(key) == 0) {
+            const auto nonspace_id = line.find_first_not_of(" \t", line.find_first_of(':') + 1);
+            return line.c_str() + nonspace_id;
+        }
+    }
+
+    return std::nullopt;
+}
+
+static uint32_t legacy_cpuinfo_count_of(const char *key)
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+
+    if (!cpuinfo.is_open() || !cpuinfo) return 0;
+
+    uint32_t counter = 0;
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.find(key) == 0) {
+            counter++;
+        }
+    }
+    return counter;
+}
+
+static uint32_t legacy_cpuinfo_unique_count_of(const char *key)
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+
+    if (!cpuinfo.is_open() || !cpuinfo) return 0;
+
+    std::unordered_set<std::string> values{};
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.find(key) == 0) {
+            const auto nonspace_id = line.find_first_not_of(" \t", line.find_first_of(':') + 1);
+            values.insert(line.c_str() + nonspace_id);
+        }
+    }
+    return values.size();
+}
+
+static cpu::cpu_info_t legacy_info()
+{
+    cpu::quantities_t quantities{};
+    quantities.logical  = legacy_cpuinfo_count_of("processor");
+    quantities.packages = legacy_cpuinfo_unique_count_of("physical id");
+    quantities.physical = quantities.packages ? quantities.logical / quantities.packages : 0;
+
+    return {
+        legacy_cpuinfo_read_first_of("model name").value_or(""),
+        vendor_cast(legacy_cpuinfo_read_first_of("vendor").value_or("")),
+        cpu::architecture(),
+        cpu::endianness(),
+        static_cast<uint64_t>(
+            std::strtod(legacy_cpuinfo_read_first_of("cpu MHz").value_or("0").c_str(), nullptr) * 1'000'000),
+        quantities,
+    };
+}
+
+static void BM_info_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_info());
+    }
+}
+BENCHMARK(BM_info_legacy)->Unit(benchmark::kMicrosecond);
+
+static void BM_info(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpu::info());
+    }
+}
+BENCHMARK(BM_info)->Unit(benchmark::kMicrosecond);
+
+// the directory walk that the one-pass caches() replaced, every index of every processor is read
+static std::optional<unsigned long> legacy_file_read_lu(const std::filesystem::path& path)
+{
+    auto          fd = ::fopen(path.c_str(), "r");
+    unsigned long value;
+
+    if (fd) {
+        defer(::fclose(fd));
+
+        if (1 == ::fscanf(fd, "%lu", &value)) {
+            return value;
+        }
+    }
+    return std::nullopt;
+}
+
+static std::string legacy_file_read(const std::string& file)
+{
+    std::ifstream ifs(file);
+
+    if (!ifs) return {};
+
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    return buffer.str();
+}
+
+static std::vector<cpu::cache_t> legacy_caches()
+{
+    std::vector<std::filesystem::path> cpus{};
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/cpu")) {
+        auto dirname = entry.path().filename().string();
+        if (std::regex_search(dirname, std::regex("\\bcpu[\\d]+"))) cpus.emplace_back(entry);
+    }
+
+    std::map<std::string, cpu::cache_t> caches;
+
+    for (const auto& cpu : cpus) {
+        for (size_t idx = 0; idx < 8; ++idx) {
+
+            std::string subdir = "cache/index" + std::to_string(idx);
+
+            if (std::filesystem::exists(cpu / subdir)) {
+                auto level = legacy_file_read_lu(cpu / subdir / "level");
+                if (!level.has_value()) continue;
+
+                auto size_str = legacy_file_read(cpu / subdir / "size");
+                if (size_str.empty()) continue;
+                auto size = std::stoul(size_str);
+                auto upos = size_str.find_first_not_of("0123456789 ");
+                if (upos != std::string::npos) {
+                    if (size_str[upos] == 'K') size *= 1'024;
+                    if (size_str[upos] == 'M') size *= 1'024 * 1'024;
+                    if (size_str[upos] == 'G') size *= 1'024 * 1'024 * 1'024;
+                }
+
+                auto line_size = legacy_file_read_lu(cpu / subdir / "coherency_line_size");
+                if (!line_size.has_value()) continue;
+
+                auto associativity = legacy_file_read_lu(cpu / subdir / "ways_of_associativity");
+                if (!associativity.has_value()) continue;
+
+                auto id = legacy_file_read_lu(cpu / subdir / "id");
+                if (!id.has_value()) continue;
+
+                auto type_str = probe::util::trim(legacy_file_read(cpu / subdir / "type"));
+                if (type_str.empty()) continue;
+                auto type = cpu::to_cache_type(type_str);
+
+                caches[type_str + std::to_string(((level.value() << 8) | id.value()))] = cpu::cache_t{
+                    .level         = static_cast<int32_t>(level.value()),
+                    .associativity = static_cast<int32_t>(associativity.value()),
+                    .line_size     = line_size.value(),
+                    .size          = size,
+                    .type          = type,
+                };
+            }
+        }
+    }
+
+    std::vector<cpu::cache_t> ret;
+    for (const auto& [k, v] : caches) {
+        ret.emplace_back(v);
+    }
+    return ret;
+}
+
+static void BM_caches_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_caches());
+    }
+}
+BENCHMARK(BM_caches_legacy)->Unit(benchmark::kMicrosecond);
+
+static void BM_caches(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpu::caches());
+    }
+}
+BENCHMARK(BM_caches)->Unit(benchmark::kMicrosecond);
+
+static void BM_sampler(benchmark::State& state)
+{
+    cpu::sampler sampler{};
+    sampler.sample();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler.sample());
+    }
+}
+BENCHMARK(BM_sampler)->Unit(benchmark::kMicrosecond);
+
+// is_supported() before the snapshot, cpuid is executed twice by each query
+static bool legacy_is_supported(cpu::feature_t feature)
+{
+    int32_t info[4]{};
+
+    cpu::cpuid(info, 0, 0);
+
+    auto [leaf, subleaf, reg, bit] = cpu::unpack(feature);
+
+    if (info[0] >= leaf) {
+        cpu::cpuid(info, leaf, subleaf);
+
+        return (info[reg] & (0x01 << bit));
+    }
+    return false;
+}
+
+static void BM_is_supported_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_is_supported(cpu::feature_t::avx2));
+    }
+}
+BENCHMARK(BM_is_supported_legacy);
+
+static void BM_has(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpu::has(cpu::feature_t::avx2));
+    }
+}
+BENCHMARK(BM_has);
+
+static void BM_instruction_sets(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpu::instruction_sets());
+    }
+}
+BENCHMARK(BM_instruction_sets);
+
+static int64_t add_scalar(int64_t a, int64_t b) { return a + b; }
+
+static void BM_dispatch(benchmark::State& state)
+{
+    static const cpu::dispatch<int64_t(int64_t, int64_t)> add{
+        { { cpu::feature_t::avx512_f }, add_scalar },
+        { {}, add_scalar },
+    };
+
+    int64_t value = 0;
+    for (auto _ : state) {
+        value = add(value, 1);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_dispatch);
+
+#endif
@@ -0,0 +1,38 @@
+#ifdef __linux__
+
+#include "probe/memory.h"
+
+#include <benchmark/benchmark.h>
+#include <sys/sysinfo.h>
+
+using namespace probe;
+
+// status() before /proc/meminfo was parsed, the free memory excluded the reclaimable caches
+static memory::memory_status_t legacy_status()
+{
+    struct sysinfo info{};
+    ::sysinfo(&info);
+
+    return {
+        .avail = info.freeram,
+        .total = info.totalram,
+    };
+}
+
+static void BM_status_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_status());
+    }
+}
+BENCHMARK(BM_status_legacy)->Unit(benchmark::kMicrosecond);
+
+static void BM_status(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(memory::status());
+    }
+}
+BENCHMARK(BM_status)->Unit(benchmark::kMicrosecond);
+
+#endif
@@ -0,0 +1,508 @@
+#ifdef __linux__
+
+#include "probe/defer.h"
+#include "probe/network.h"
+#include "probe/sysfs.h"
+#include "probe/util.h"
+
+#include <arpa/inet.h>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ifaddrs.h>
+#include <linux/ethtool.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <regex>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace probe;
+using namespace probe::network;
+
+static std::vector<std::string> fread_list(const std::string& file)
+{
+    std::ifstream fd(file);
+
+    if (!fd.is_open() || !fd) return {};
+
+    std::vector<std::string> list{};
+    for (std::string line; std::getline(fd, line);) {
+        list.emplace_back(line);
+    }
+
+    return list;
+}
+
+// adapters() before the netlink dumps, /proc/net/dev plus ioctls, and /proc/net/if_inet6 per interface
+static std::vector<adapter_t> legacy_adapters()
+{
+    ifaddrs *addresses;
+    if (::getifaddrs(&addresses) == -1) return {};
+    defer(::freeifaddrs(addresses));
+
+    std::vector<adapter_t> ret;
+
+    // device name
+    auto list = fread_list("/proc/net/dev");
+    if (list.size() <= 2) return {};
+
+    for (size_t i = 2; i < list.size(); ++i) {
+        auto lpos = list[i].find_first_not_of(probe::util::whitespace);
+        auto rpos = list[i].find(':');
+        if (lpos != std::string::npos && rpos != std::string::npos && lpos < rpos) {
+            ret.emplace_back(adapter_t{ .name = list[i].substr(lpos, rpos - lpos) });
+        }
+    }
+
+    // buses
+    auto buses = probe::sys::buses();
+
+    //
+    int fd = ::socket(PF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return ret;
+
+    for (size_t i = 0; i < ret.size(); ++i) {
+
+        // physical address
+        ifreq ifr{};
+        ::memset(&ifr, 0, sizeof(ifr));
+        ::strcpy(ifr.ifr_name, ret[i].name.c_str());
+        if (::ioctl(fd, SIOCGIFHWADDR, &ifr) == 0) {
+            ret[i].type        = static_cast<if_type_t>(ifr.ifr_hwaddr.sa_family);
+            ret[i].description = probe::to_string(ret[i].type) + " Interface";
+            // physical address
+            char buffer[18]{};
+            ::sprintf(buffer, "%02x:%02x:%02x:%02x:%02x:%02x",
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[0]),
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[1]),
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[2]),
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[3]),
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[4]),
+                      static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[5]));
+            ret[i].physical_address = buffer;
+        }
+
+        // mtu
+        if (::ioctl(fd, SIOCGIFMTU, &ifr) == 0) {
+            ret[i].mtu = ifr.ifr_mtu;
+        }
+
+        // ipv4 address
+        ifr.ifr_addr.sa_family = AF_INET;
+        if (::ioctl(fd, SIOCGIFADDR, &ifr) == 0) {
+            ret[i].ipv4_addresses.emplace_back(
+                ::inet_ntoa(reinterpret_cast<sockaddr_in *>(&ifr.ifr_addr)->sin_addr));
+        }
+
+        // ipv6 address
+        {
+            auto ifv6_fd = ::fopen("/proc/net/if_inet6", "r");
+            if (ifv6_fd) {
+                unsigned char ipv6[16]{};
+                char          dname[IFNAMSIZ]{};
+                unsigned int  if_idx{}, plen{}, scope{};
+
+                while (20 == ::fscanf(ifv6_fd,
+                                      "%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx"
+                                      "%2hhx%2hhx%2hhx%2hhx %02x %02x %02x %*s %s",
+                                      &ipv6[0], &ipv6[1], &ipv6[2], &ipv6[3], &ipv6[4], &ipv6[5],
+                                      &ipv6[6], &ipv6[7], &ipv6[8], &ipv6[9], &ipv6[10], &ipv6[11],
+                                      &ipv6[12], &ipv6[13], &ipv6[14], &ipv6[15], &if_idx, &plen,
+                                      &scope, dname)) {
+                    if (::strcmp(dname, ret[i].name.c_str()) == 0) {
+                        char address[INET6_ADDRSTRLEN]{};
+                        ::inet_ntop(AF_INET6, ipv6, address, INET6_ADDRSTRLEN);
+                        ret[i].ipv6_addresses.emplace_back(std::string{ address } + "/" +
+                                                           std::to_string(plen));
+                    }
+                }
+
+                ::fclose(ifv6_fd);
+            }
+        }
+
+        // bus info
+        auto [device_path, driver_path] = probe::sys::device_by_class("net", ret[i].name);
+        auto bus_name                   = probe::sys::guess_bus(driver_path);
+        ret[i].bus                      = bus_cast(bus_name);
+        ret[i].id                       = device_path;
+
+        if (std::regex_search(device_path.filename().string(),
+                              std::regex(R"(^\d\d\d\d:\d\d:\d\d.\d$)"))) {
+            ret[i].bus_info = device_path.filename();
+        }
+
+        // vendor
+        auto vendor_fd = ::fopen((device_path / "vendor").c_str(), "r");
+        if (vendor_fd) {
+            uint32_t vendor_id{};
+            if (::fscanf(vendor_fd, "%x", &vendor_id) == 1) {
+                ret[i].vendor_id    = vendor_cast(vendor_id);
+                ret[i].manufacturer = probe::to_string(ret[i].vendor_id);
+
+                // product
+                uint32_t product_id{};
+                auto     product_fd = ::fopen((device_path / "device").c_str(), "r");
+                if (product_fd) {
+                    if (::fscanf(product_fd, "%x", &product_id) == 1) {
+                        ret[i].product = probe::product_name(vendor_id, product_id);
+                    }
+                    ::fclose(product_fd);
+                }
+            }
+
+            ::fclose(vendor_fd);
+        }
+
+        // flags
+        if (::ioctl(fd, SIOCGIFFLAGS, &ifr) == 0) {
+            ret[i].enabled = ifr.ifr_flags & IFF_UP;
+        }
+
+        char buffer[2 * IFNAMSIZ + 1]{};
+        ::strncpy(buffer, ret[i].name.c_str(), sizeof(buffer) - 1);
+        if (::ioctl(fd, 0x8B01, &buffer) == 0) {
+            ret[i].description = "Wireless Interface (" + std::string{ buffer + IFNAMSIZ } + ")";
+        }
+
+        // driver
+        ethtool_drvinfo drvinfo{};
+        drvinfo.cmd  = ETHTOOL_GDRVINFO;
+        ifr.ifr_data = reinterpret_cast<caddr_t>(&drvinfo);
+        if (::ioctl(fd, SIOCETHTOOL, &ifr) == 0) {
+            ret[i].driver         = drvinfo.driver;
+            ret[i].driver_version = drvinfo.version;
+            if (!std::string{ drvinfo.bus_info }.empty()) ret[i].bus_info = drvinfo.bus_info;
+        }
+
+        ret[i].is_virtual = virtual_physical_addresses.contains(ret[i].physical_address.substr(0, 8));
+    }
+
+    return ret;
+}
+
+// the counters of all interfaces read from /sys/class/net/<name>/statistics, a file per counter
+static std::vector<network::traffic_status_t> legacy_status()
+{
+    std::vector<network::traffic_status_t> list{};
+
+    std::error_code ec{};
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/class/net", ec)) {
+        const auto dir = entry.path() / "statistics";
+
+        const auto counter = [&](const char *name) {
+            uint64_t      value{};
+            std::ifstream(dir / name) >> value;
+            return value;
+        };
+
+        list.emplace_back(network::traffic_status_t{
+            .name     = entry.path().filename().string(),
+            .ibytes   = counter("rx_bytes"),
+            .obytes   = counter("tx_bytes"),
+            .ipackets = counter("rx_packets"),
+            .opackets = counter("tx_packets"),
+            .idrops   = counter("rx_dropped"),
+            .odrops   = counter("tx_dropped"),
+            .ierrors  = counter("rx_errors"),
+            .oerrors  = counter("tx_errors"),
+        });
+    }
+
+    return list;
+}
+
+static void BM_traffic_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_status());
+    }
+}
+BENCHMARK(BM_traffic_legacy)->Unit(benchmark::kMicrosecond);
+
+static void BM_traffic_sampler(benchmark::State& state)
+{
+    network::traffic_sampler sampler{};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler.sample());
+    }
+}
+BENCHMARK(BM_traffic_sampler)->Unit(benchmark::kMicrosecond);
+
+// sockets: /proc/net/tcp{,6} text, a line per socket
+//   sl  local_address rem_address   st tx_queue rx_queue tr tm->when retrnsmt   uid  timeout inode
+//    0: 0100007F:0277 00000000:0000 0A 00000000:00000000 00:00000000 00000000     0        0 662 ...
+static void legacy_tcp(const char *file, int family, std::vector<socket_t>& list)
+{
+    const auto fp = ::fopen(file, "r");
+    if (!fp) return;
+    defer(::fclose(fp));
+
+    char line[512];
+    if (!::fgets(line, sizeof(line), fp)) return;
+
+    while (::fgets(line, sizeof(line), fp)) {
+        char          local[33]{}, remote[33]{};
+        unsigned int  lport{}, rport{}, state{}, tx{}, rx{}, uid{};
+        unsigned long inode{};
+        constexpr auto format = "%*d: %32[0-9A-Fa-f]:%X %32[0-9A-Fa-f]:%X %X %X:%X %*X:%*X %*X %u %*d %lu";
+        if (::sscanf(line, format, local, &lport, remote, &rport, &state, &tx, &rx, &uid, &inode) != 9)
+            continue;
+
+        // the address is printed as 32-bit words in the host byte order
+        const auto address = [family](const char *hex) {
+            uint32_t words[4]{};
+            for (size_t i = 0; i < (family == AF_INET ? 1 : 4); ++i) {
+                char word[9]{};
+                std::memcpy(word, hex + i * 8, 8);
+                words[i] = static_cast<uint32_t>(std::strtoul(word, nullptr, 16));
+            }
+
+            char buffer[INET6_ADDRSTRLEN]{};
+            ::inet_ntop(family, words, buffer, sizeof(buffer));
+            return std::string{ buffer };
+        };
+
+        list.emplace_back(socket_t{
+            .protocol       = socket_protocol_t::tcp,
+            .family         = family,
+            .type           = SOCK_STREAM,
+            .state          = static_cast<socket_state_t>(state),
+            .local_address  = address(local),
+            .local_port     = static_cast<uint16_t>(lport),
+            .remote_address = address(remote),
+            .remote_port    = static_cast<uint16_t>(rport),
+            .inode          = inode,
+            .uid            = uid,
+            .rqueue         = rx,
+            .wqueue         = tx,
+        });
+    }
+}
+
+static std::vector<socket_t> legacy_sockets()
+{
+    std::vector<socket_t> list{};
+    legacy_tcp("/proc/net/tcp", AF_INET, list);
+    legacy_tcp("/proc/net/tcp6", AF_INET6, list);
+    return list;
+}
+
+// listening TCP sockets on the loopback, kept open until the process exits
+static bool listen_sockets(size_t count)
+{
+    static std::vector<int> fds{};
+
+    rlimit limit{};
+    ::getrlimit(RLIMIT_NOFILE, &limit);
+    if (limit.rlim_cur < count + 64) {
+        limit.rlim_cur = std::min<rlim_t>(count + 64, limit.rlim_max);
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    while (fds.size() < count) {
+        const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) return false;
+        fds.push_back(fd);
+
+        sockaddr_in addr{};
+        addr.sin_family      = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 || ::listen(fd, 8) < 0)
+            return false;
+    }
+    return true;
+}
+
+static void BM_sockets_legacy(benchmark::State& state)
+{
+    if (!listen_sockets(static_cast<size_t>(state.range(0)))) {
+        state.SkipWithError("too many open files");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_sockets());
+    }
+}
+
+static void BM_sockets(benchmark::State& state)
+{
+    if (!listen_sockets(static_cast<size_t>(state.range(0)))) {
+        state.SkipWithError("too many open files");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(network::sockets({ .udp = false, .unix_domain = false }));
+    }
+}
+
+// streaming, counts the listening sockets without the vector
+static void BM_sockets_stream(benchmark::State& state)
+{
+    if (!listen_sockets(static_cast<size_t>(state.range(0)))) {
+        state.SkipWithError("too many open files");
+        return;
+    }
+
+    for (auto _ : state) {
+        size_t count = 0;
+        network::sockets({ .udp = false, .unix_domain = false }, [&](const socket_t& socket) {
+            count += socket.state == socket_state_t::listen;
+            return true;
+        });
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+// the sockets are only added, run all versions with the same number before adding more.
+// before BM_adapters, which moves the process into a new network namespace
+BENCHMARK(BM_sockets_legacy)->Unit(benchmark::kMillisecond)->Arg(1'000);
+BENCHMARK(BM_sockets)->Unit(benchmark::kMillisecond)->Arg(1'000);
+BENCHMARK(BM_sockets_stream)->Unit(benchmark::kMillisecond)->Arg(1'000);
+BENCHMARK(BM_sockets_legacy)->Unit(benchmark::kMillisecond)->Arg(10'000);
+BENCHMARK(BM_sockets)->Unit(benchmark::kMillisecond)->Arg(10'000);
+BENCHMARK(BM_sockets_stream)->Unit(benchmark::kMillisecond)->Arg(10'000);
+
+// routes: a fork of `ip route get` per destination
+static void BM_route_get_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::exec_sync({ "ip", "route", "get", "10.1.2.3" }));
+    }
+}
+BENCHMARK(BM_route_get_legacy)->Unit(benchmark::kMicrosecond);
+
+// the main table plus the /24 routes of 10.0.0.0/8, a lookup per destination
+static void BM_route_lookup(benchmark::State& state)
+{
+    auto routes = network::routes();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(state.range(0)); ++i) {
+        routes.emplace_back(route_t{
+            .family      = AF_INET,
+            .destination = "10." + std::to_string((i >> 8) & 0xff) + "." + std::to_string(i & 0xff) + ".0",
+            .prefix      = 24,
+            .gateway     = "192.0.2.1",
+        });
+    }
+
+    const network::route_table table(routes);
+
+    std::vector<std::array<uint8_t, 4>> destinations(4'096);
+    for (uint32_t i = 0; i < destinations.size(); ++i) {
+        const auto x    = i * 2'654'435'761u; // Knuth's multiplicative hash, spread over the table
+        destinations[i] = { 10, static_cast<uint8_t>(x >> 24), static_cast<uint8_t>(x >> 16), 1 };
+    }
+
+    for (auto _ : state) {
+        for (const auto& destination : destinations) {
+            benchmark::DoNotOptimize(table.lookup(AF_INET, destination));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * destinations.size()));
+}
+BENCHMARK(BM_route_lookup)->Unit(benchmark::kMicrosecond)->Arg(1'000)->Arg(60'000);
+
+// RTM_NEWLINK of a device-less interface of the kind, e.g. "dummy", or "veth" which creates a pair
+static bool create_link(int fd, const char *kind)
+{
+    struct
+    {
+        nlmsghdr  header;
+        ifinfomsg ifi;
+        char      attributes[64];
+    } request{};
+
+    request.header.nlmsg_type  = RTM_NEWLINK;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_CREATE | NLM_F_EXCL | NLM_F_ACK;
+    request.header.nlmsg_len   = NLMSG_LENGTH(sizeof(ifinfomsg));
+    request.ifi.ifi_family     = AF_UNSPEC;
+
+    const auto append = [&](rtattr *parent, uint16_t type, const void *data, size_t size) {
+        const auto rta = reinterpret_cast<rtattr *>(reinterpret_cast<char *>(&request.header) +
+                                                    NLMSG_ALIGN(request.header.nlmsg_len));
+        rta->rta_type  = type;
+        rta->rta_len   = static_cast<uint16_t>(RTA_LENGTH(size));
+        if (size) std::memcpy(RTA_DATA(rta), data, size);
+
+        request.header.nlmsg_len = NLMSG_ALIGN(request.header.nlmsg_len) + RTA_ALIGN(rta->rta_len);
+        if (parent) parent->rta_len = static_cast<uint16_t>(RTA_ALIGN(parent->rta_len) + rta->rta_len);
+        return rta;
+    };
+
+    const auto linkinfo = append(nullptr, IFLA_LINKINFO, nullptr, 0);
+    append(linkinfo, IFLA_INFO_KIND, kind, std::strlen(kind) + 1);
+
+    if (::send(fd, &request, request.header.nlmsg_len, 0) < 0) return false;
+
+    char buffer[1'024];
+    if (::recv(fd, buffer, sizeof(buffer), 0) < 0) return false;
+
+    const auto nh = reinterpret_cast<nlmsghdr *>(buffer);
+    return nh->nlmsg_type == NLMSG_ERROR && static_cast<nlmsgerr *>(NLMSG_DATA(nh))->error == 0;
+}
+
+// moves the process into a new network namespace, and adds the links up to the number
+static bool populate(size_t count)
+{
+    static int    fd = -1;
+    static size_t links{};
+
+    if (fd < 0) {
+        if (::unshare(CLONE_NEWNET) < 0) return false;
+
+        fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+        if (fd < 0) return false;
+    }
+
+    for (; links < count; ++links) {
+        if (!create_link(fd, "dummy") && !create_link(fd, "veth")) return false;
+    }
+    return true;
+}
+
+static void BM_adapters_legacy(benchmark::State& state)
+{
+    if (!populate(static_cast<size_t>(state.range(0)))) {
+        state.SkipWithError("requires CAP_NET_ADMIN to create the interfaces in a network namespace");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_adapters());
+    }
+}
+
+static void BM_adapters(benchmark::State& state)
+{
+    if (!populate(static_cast<size_t>(state.range(0)))) {
+        state.SkipWithError("requires CAP_NET_ADMIN to create the interfaces in a network namespace");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(network::adapters());
+    }
+}
+
+// the interfaces are only added, run both versions with the same number before adding more
+BENCHMARK(BM_adapters_legacy)->Unit(benchmark::kMillisecond)->Arg(16);
+BENCHMARK(BM_adapters)->Unit(benchmark::kMillisecond)->Arg(16);
+BENCHMARK(BM_adapters_legacy)->Unit(benchmark::kMillisecond)->Arg(256);
+BENCHMARK(BM_adapters)->Unit(benchmark::kMillisecond)->Arg(256);
+BENCHMARK(BM_adapters_legacy)->Unit(benchmark::kMillisecond)->Arg(1'024);
+BENCHMARK(BM_adapters)->Unit(benchmark::kMillisecond)->Arg(1'024);
+
+#endif
@@ -0,0 +1,301 @@
+#ifdef __linux__
+
+#include "probe/defer.h"
+#include "probe/process.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <unistd.h>
+
+using namespace probe::process;
+
+// the fscanf-based parser that parse_stat replaced
+static pstat_t legacy_parse_stat(const std::string& pid)
+{
+    auto    stat_fd = ::fopen(("/proc/" + pid + "/stat").c_str(), "r");
+    pstat_t s{};
+    char    buffer[512]{};
+
+    if (stat_fd) {
+        defer(::fclose(stat_fd));
+
+        if (::fscanf(stat_fd,
+                     "%d %s %c %d %d %d %d %d %u %lu %lu %lu %lu %lu %lu %ld %ld %ld %ld %ld %*s %llu %lu %ld "
+                     "%lu %lu %lu %lu %lu %lu %*s %*s %*s %*s %lu %*s %*s %d %d %u %u %llu %lu %ld",
+                     &s.pid, buffer, &s.state, &s.ppid, &s.pgrp, &s.session, &s.tty_nr, &s.tpgid, &s.flags,
+                     &s.minflt, &s.cminflt, &s.majflt, &s.cmajflt, &s.utime, &s.stime, &s.cutime, &s.cstime,
+                     &s.priority, &s.nice, &s.nb_threads, &s.starttime, &s.vsize, &s.rss, &s.rsslim,
+                     &s.startcode, &s.endcode, &s.startstack, &s.kstkesp, &s.kstkeip, &s.wchan,
+                     &s.exit_signal, &s.processor, &s.rt_priority, &s.policy, &s.blkio_ticks, &s.guest_time,
+                     &s.cguest_time) == 0) {
+            return {};
+        }
+    }
+
+    std::string comm = buffer;
+    auto        fpos = comm.find_first_of("(");
+    auto        lpos = comm.find_last_of(")");
+    if (fpos != std::string::npos && lpos != std::string::npos) {
+        s.comm = comm.substr(fpos + 1, lpos - fpos - 1);
+    }
+
+    return s;
+}
+
+static void BM_parse_stat_legacy(benchmark::State& state)
+{
+    const auto pid = std::to_string(::getpid());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_parse_stat(pid));
+    }
+}
+BENCHMARK(BM_parse_stat_legacy);
+
+static void BM_parse_stat_string(benchmark::State& state)
+{
+    const auto pid = std::to_string(::getpid());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_stat(pid));
+    }
+}
+BENCHMARK(BM_parse_stat_string);
+
+static void BM_parse_stat_buffer(benchmark::State& state)
+{
+    const auto pid = static_cast<uint64_t>(::getpid());
+    char       buffer[1'024];
+    pstat_t    stat{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_stat(pid, stat, buffer));
+    }
+}
+BENCHMARK(BM_parse_stat_buffer);
+
+// parsing only, without the syscalls
+static void BM_parse_stat_text(benchmark::State& state)
+{
+    char       buffer[1'024];
+    const auto text = read_proc("self/stat", buffer);
+    pstat_t    stat{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_stat_text(text, stat));
+    }
+}
+BENCHMARK(BM_parse_stat_text);
+
+// the std::map and std::regex based parser that parse_status replaced
+static std::vector<unsigned long> legacy_parse_uids(const std::string& str)
+{
+    std::smatch matchs;
+    if (std::regex_match(str, matchs, std::regex("(\\d+)\t(\\d+)\t(\\d+)\t(\\d+)"))) {
+        return {
+            std::stoul(matchs[1].str()),
+            std::stoul(matchs[2].str()),
+            std::stoul(matchs[3].str()),
+            std::stoul(matchs[4].str()),
+        };
+    }
+    return { 0, 0, 0, 0 };
+}
+
+static pstatus_t legacy_parse_status(const std::string& pid)
+{
+    std::ifstream status_fd("/proc/" + pid + "/status");
+    if (!status_fd.is_open() || !status_fd) return {};
+
+    std::map<std::string, std::string> mapping;
+    for (std::string line; std::getline(status_fd, line);) {
+        auto pos = line.find_first_of(":");
+        if (pos != std::string::npos) {
+            mapping[line.substr(0, pos)] = line.substr(pos + 2); // skip ":\t"
+        }
+    }
+
+#define MAPPING_INT(X, F, D) (mapping.contains(#X) ? std::sto##F(mapping[#X]) : D)
+#define MAPPING_HEX(X, F, D) (mapping.contains(#X) ? std::sto##F(mapping[#X], nullptr, 16) : D)
+#define MAPPING_STR(X, D)    (mapping.contains(#X) ? mapping[#X] : D)
+
+    auto uids = legacy_parse_uids(MAPPING_STR(Uid, ""));
+    auto gids = legacy_parse_uids(MAPPING_STR(Gid, ""));
+
+    // clang-format off
+    return pstatus_t {
+        .name       = MAPPING_STR(Name, ""),
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 7, 0)
+        .umask      = (mapping.contains("Umask") ? std::stoul(mapping["Umask"], nullptr, 8) : 0),
+#endif
+
+        .state      = static_cast<pstate_t>(MAPPING_STR(State, std::string("\0"))[0]),
+
+        .tgid       = MAPPING_INT(Tgid, i, 0),
+        .ngid       = MAPPING_INT(Ngid, i, 0),
+        .pid        = MAPPING_INT(Pid, i, 0),
+        .ppid       = MAPPING_INT(PPid, i, 0),
+
+        .tracer_pid = MAPPING_INT(TracerPid, i, 0),
+
+        .ruid       = static_cast<uid_t>(uids[0]),
+        .euid       = static_cast<uid_t>(uids[1]),
+        .suid       = static_cast<uid_t>(uids[2]),
+        .fuid       = static_cast<uid_t>(uids[3]),
+
+        .rgid       = static_cast<gid_t>(gids[0]),
+        .egid       = static_cast<gid_t>(gids[1]),
+        .sgid       = static_cast<gid_t>(gids[2]),
+        .fgid       = static_cast<gid_t>(gids[3]),
+
+        .fd_size    = MAPPING_INT(FDSize, l, 0),
+        .groups     = MAPPING_STR(Groups, ""),
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 1, 0)
+        .nstgid     = MAPPING_INT(NStgid, i, 0),
+        .nspid      = MAPPING_INT(NSpid, i, 0),
+        .nspgid     = MAPPING_INT(NSpgid, i, 0),
+        .nssid      = MAPPING_INT(NSsid, i, 0),
+#endif
+
+        .vm_peak    = MAPPING_INT(VmPeak, ul, 0),
+        .vm_size    = MAPPING_INT(VmSize, ul, 0),
+        .vm_lck     = MAPPING_INT(VmLck, ul, 0),
+        .vm_pin     = MAPPING_INT(VmPin, ul, 0),
+        .vm_hwm     = MAPPING_INT(VmHWM, ul, 0),
+        .vm_rss     = MAPPING_INT(VmRSS, ul, 0),
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
+        .rss_anon   = MAPPING_INT(RssAnon, ul, 0),
+        .rss_file   = MAPPING_INT(RssFile, ul, 0),
+        .rss_shmem  = MAPPING_INT(RssShmem, ul, 0),
+#endif
+        .vm_data    = MAPPING_INT(VmData,ul, 0),
+        .vm_stk     = MAPPING_INT(VmStk, ul, 0),
+        .vm_exe     = MAPPING_INT(VmExe, ul, 0),
+        .vm_lib     = MAPPING_INT(VmLib, ul, 0),
+        .vm_pte     = MAPPING_INT(VmPTE, ul, 0),
+        .vm_swap    = MAPPING_INT(VmSwap, ul, 0),
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 4, 0)
+        .hugetlb_pages = MAPPING_INT(HugetlbPages, ul, 0),
+#endif
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
+        .core_dumping = MAPPING_INT(CoreDumping, i, 0),
+#endif
+
+        .threads    = MAPPING_INT(Threads, l, 0),
+
+        .sigpnd     = MAPPING_HEX(SigPnd, ul, 0),
+        .shdpnd     = MAPPING_HEX(ShdPnd, ul, 0),
+        .sigblk     = MAPPING_HEX(SigBlk, ul, 0),
+        .sigign     = MAPPING_HEX(SigIgn, ul, 0),
+        .sigcgt     = MAPPING_HEX(SigCgt, ul, 0),
+
+        .capinh     = MAPPING_HEX(CapInh, ul, 0),
+        .capprm     = MAPPING_HEX(CapPrm, ul, 0),
+        .capeff     = MAPPING_HEX(CapEff, ul, 0),
+        .capbnd     = MAPPING_HEX(CapBnd, ul, 0),
+        .capamb     = MAPPING_HEX(CapAmb, ul, 0),
+
+        .voluntary_ctxt_switches    = MAPPING_INT(voluntary_ctxt_switches, ul, 0),
+        .nonvoluntary_ctxt_switches = MAPPING_INT(nonvoluntary_ctxt_switches, ul, 0),
+    };
+    // clang-format on
+
+#undef MAPPING_HEX
+#undef MAPPING_INT
+#undef MAPPING_STR
+}
+
+static void BM_parse_status_legacy(benchmark::State& state)
+{
+    const auto pid = std::to_string(::getpid());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_parse_status(pid));
+    }
+}
+BENCHMARK(BM_parse_status_legacy);
+
+static void BM_parse_status_buffer(benchmark::State& state)
+{
+    const auto pid = static_cast<uint64_t>(::getpid());
+    char       buffer[4'096];
+    pstatus_t  status{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_status(pid, status, buffer));
+    }
+}
+BENCHMARK(BM_parse_status_buffer);
+
+// parsing only, without the syscalls
+static void BM_parse_status_text(benchmark::State& state)
+{
+    char       buffer[4'096];
+    const auto text = read_proc("self/status", buffer);
+    pstatus_t  status{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_status_text(text, status));
+    }
+}
+BENCHMARK(BM_parse_status_text);
+
+static void BM_processes(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(processes());
+    }
+}
+BENCHMARK(BM_processes)->Unit(benchmark::kMicrosecond);
+
+// scaling by the number of worker threads, wall time
+static void BM_processes_threads(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(processes(static_cast<size_t>(state.range(0))));
+    }
+}
+BENCHMARK(BM_processes_threads)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// steady state, only /proc/[pid]/stat of the known processes is re-read
+static void BM_snapshotter_update(benchmark::State& state)
+{
+    snapshotter snapshot{};
+    snapshot.update();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(snapshot.update());
+    }
+}
+BENCHMARK(BM_snapshotter_update)->Unit(benchmark::kMicrosecond);
+
+static void BM_threads(benchmark::State& state)
+{
+    const auto pid = static_cast<uint64_t>(::getpid());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(threads(pid));
+    }
+}
+BENCHMARK(BM_threads);
+
+static void BM_threads_reuse(benchmark::State& state)
+{
+    const auto            pid = static_cast<uint64_t>(::getpid());
+    std::vector<thread_t> list{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(threads(pid, list));
+    }
+}
+BENCHMARK(BM_threads_reuse);
+
+static void BM_cpu_sampler(benchmark::State& state)
+{
+    cpu_sampler sampler{};
+    sampler.sample();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler.sample());
+    }
+}
+BENCHMARK(BM_cpu_sampler)->Unit(benchmark::kMicrosecond);
+
+#endif
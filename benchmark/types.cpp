@@ -0,0 +1,203 @@
+#include "probe/pciids.h"
+#include "probe/types.h"
+
+#include <benchmark/benchmark.h>
+#include <regex>
+#include <vector>
+
+// the switch-based lookups that the sorted tables replaced
+static std::string legacy_vendor_cast(probe::vendor_t vendor)
+{
+    // clang-format off
+    switch (static_cast<uint32_t>(vendor)) {
+#define V(ID, STR) case ID: return STR;
+    PCIIDS_VENDORS
+#undef V
+    default: return "Unknown";
+    }
+    // clang-format on
+}
+
+// the regex-based matching that the case-folded name index replaced
+static probe::vendor_t legacy_vendor_cast(const std::string& name)
+{
+    if (std::regex_search(name, std::regex("\\bGenuineIntel\\b", std::regex_constants::icase)))
+        return probe::vendor_t::Intel;
+
+#define V(ID, STR)                                                                                         \
+    if (std::regex_match(STR, std::regex(name, std::regex_constants::icase)))                              \
+        return static_cast<probe::vendor_t>(ID);
+    PCIIDS_VENDORS
+#undef V
+
+    return probe::vendor_t::Unknown;
+}
+
+// the regex-based matching that the pattern table replaced
+static probe::bus_type_t legacy_bus_cast(const std::string& str)
+{
+    using probe::bus_type_t;
+#define SEARCH_IF(REGEX, RES)                                                                              \
+    if (std::regex_search(                                                                                 \
+            str, std::regex(REGEX, std::regex_constants::ECMAScript | std::regex_constants::icase)))       \
+    return RES
+
+    SEARCH_IF("\\bAC97\\b", bus_type_t::AC97);
+    SEARCH_IF("\\bACPI\\b|Advanced[ _-]Configuration[ _-]and[ _-]Power[ _-]Interface", bus_type_t::ACPI);
+    SEARCH_IF("\\bAuxiliary\\b", bus_type_t::Auxiliary);
+    SEARCH_IF("\\bATA\\b|Advanced[ _-]?Technology[ _-]?Attachment", bus_type_t::ATA);
+    SEARCH_IF("\\bCAN\\b|Controller[ _-]?Area[ _-]?Network", bus_type_t::CAN);
+    SEARCH_IF("\\bCEC\\b|Consumer[ _-]?Electronics[ _-]?Control", bus_type_t::CEC);
+    SEARCH_IF("\\bCPU\\b", bus_type_t::CPU);
+    SEARCH_IF("\\bEISA\\b|Extended[ _-]?ISA|Extended[ _-]?Industry[ _-]?Standard[ _-]?Architecture",
+              bus_type_t::EISA);
+    SEARCH_IF("\\bFibre\\b", bus_type_t::Fibre);
+    SEARCH_IF("File[ _-]?Backed[ _-]?Virtual", bus_type_t::FileBackedVirtual);
+    SEARCH_IF("\\bGPIO\\b|General[ _-]?Purpose[ _-]?Input/Output", bus_type_t::GPIO);
+    SEARCH_IF("HD[ _-]?Audio", bus_type_t::HDAudio);
+    SEARCH_IF("\\bID\\b|Human[ _-]?Interface[ _-]?Device", bus_type_t::HID);
+    SEARCH_IF("IEEE[ _-]?1394", bus_type_t::IEEE1394);
+    SEARCH_IF("\\bI2C\\b|IIC|Inter[ _-]?Integrated[ _-]?Circuit", bus_type_t::I2C);
+    SEARCH_IF("\\bIDE\\b", bus_type_t::IDE);
+    SEARCH_IF("\\bISA\\b|Industry[ _-]?Standard[ _-]?Architecture", bus_type_t::ISA);
+    SEARCH_IF("\\biSCSI\\b|Internet[ _-]?Small[ _-]?Computer[ _-]?Systems[ _-]?Interface", bus_type_t::iSCSI);
+    SEARCH_IF("\\bMAX\\b", bus_type_t::MAX);
+    SEARCH_IF("\\bMDIO\\b|Management[ _-]?Data[ _-]?Input/Output", bus_type_t::MDIO);
+    SEARCH_IF("\\bSMI\\b|Serial[ _-]?Management[ _-]?Interface", bus_type_t::MDIO);
+    SEARCH_IF("\\bMIIM\\b|Media[ _-]?Independent[ _-]?Interface Management", bus_type_t::MDIO);
+    SEARCH_IF("\\bMMC\\b|Multi[ _-]Media[ _-]Card", bus_type_t::MMC);
+    SEARCH_IF("\\bNVMEM\\b", bus_type_t::NVMEM);
+    SEARCH_IF("\\bNVMe\\b|NVMHCIS|NVM[ _-]?Express", bus_type_t::NVMe);
+    SEARCH_IF("\\bPCI\\b|Peripheral[ _-]?Component[ _-]?Interconnect", bus_type_t::PCI);
+    SEARCH_IF("\\bPCI\\b[ _-]?e|PCI[ _-]?Express|Peripheral[ _-]?Component[ _-]?Interconnect[ _-]?Express",
+              bus_type_t::PCIe);
+    SEARCH_IF("\\bPnP\\b|Plug[ _-]?and[ _-]?Play", bus_type_t::PnP);
+    SEARCH_IF("\\bRAID\\b", bus_type_t::RAID);
+    SEARCH_IF("\\bSAS\\b|Serial[ _-]?Attached[ _-]?SCSI", bus_type_t::SAS);
+    SEARCH_IF("\\bSATA\\b|Serial[ _-]?ATA|Serial[ _-]?AT[ _-]?Attachment", bus_type_t::SATA);
+    SEARCH_IF("\\bSCM\\b", bus_type_t::SCM);
+    SEARCH_IF("\\bSCSI\\b", bus_type_t::SCSI);
+    SEARCH_IF("\\bSDIO\\b|\\bSD\\b", bus_type_t::SDIO);
+    SEARCH_IF("\\bSpaces\\b", bus_type_t::Spaces);
+    SEARCH_IF("\\bSPI\\b|Serial[ _-]Peripheral[ _-]Interface", bus_type_t::SPI);
+    SEARCH_IF("\\bSSA\\b|Serial[ _-]Storage[ _-]Architecture", bus_type_t::SSA);
+    SEARCH_IF("\\bUFS\\b|Universal[ _-]Flash[ _-]Storage", bus_type_t::UFS);
+    SEARCH_IF("\\bUSB\\b|Universal[ _-]Serial[ _-]Bus", bus_type_t::USB);
+    SEARCH_IF("\\bVirtio\\b", bus_type_t::Virtio);
+    SEARCH_IF("\\bVirtual\\b", bus_type_t::Virtual);
+    SEARCH_IF("\\bVME\\b|Versa[ _-]Module[ _-]Eurocard", bus_type_t::VME);
+    SEARCH_IF("\\bXen\\b", bus_type_t::Xen);
+#undef SEARCH_IF
+    return bus_type_t::Unknown;
+}
+
+static std::string legacy_product_name(uint32_t vid, uint32_t pid)
+{
+    uint32_t key = (vid << 16) | pid;
+    // clang-format off
+    switch (key) {
+#define P(ID, STR) case ID: return STR;
+        PCIIDS_DEVICES
+#undef P
+    default: return {};
+    }
+    // clang-format on
+}
+
+// every vendor id in the database and as many unknown ones
+static const std::vector<uint32_t> vendors = [] {
+    std::vector<uint32_t> ids{};
+#define V(ID, STR) ids.push_back(ID), ids.push_back(ID ^ 0x5a5a);
+    PCIIDS_VENDORS
+#undef V
+    return ids;
+}();
+
+// every product id in the database and as many unknown ones
+static const std::vector<uint32_t> products = [] {
+    std::vector<uint32_t> ids{};
+#define P(ID, STR) ids.push_back(ID), ids.push_back(ID ^ 0x5a5a);
+    PCIIDS_DEVICES
+#undef P
+    return ids;
+}();
+
+static void BM_vendor_cast_legacy(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto id = static_cast<probe::vendor_t>(vendors[i++ % vendors.size()]);
+        benchmark::DoNotOptimize(legacy_vendor_cast(id));
+    }
+}
+BENCHMARK(BM_vendor_cast_legacy);
+
+static void BM_vendor_cast(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto id = static_cast<probe::vendor_t>(vendors[i++ % vendors.size()]);
+        benchmark::DoNotOptimize(probe::vendor_cast(id));
+    }
+}
+BENCHMARK(BM_vendor_cast);
+
+static void BM_product_name_legacy(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto id = products[i++ % products.size()];
+        benchmark::DoNotOptimize(legacy_product_name(id >> 16, id & 0xffff));
+    }
+}
+BENCHMARK(BM_product_name_legacy);
+
+static void BM_product_name(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto id = products[i++ % products.size()];
+        benchmark::DoNotOptimize(probe::product_name(id >> 16, id & 0xffff));
+    }
+}
+BENCHMARK(BM_product_name);
+
+static void BM_vendor_cast_name_legacy(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_vendor_cast(std::string{ "Intel Corporation" }));
+    }
+}
+BENCHMARK(BM_vendor_cast_name_legacy)->Unit(benchmark::kMillisecond);
+
+static void BM_vendor_cast_name(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(probe::vendor_cast(std::string{ "Intel Corporation" }));
+    }
+}
+BENCHMARK(BM_vendor_cast_name);
+
+// the bus names in /sys/bus/<bus>/drivers, and some descriptive ones
+static const std::vector<std::string> buses = {
+    "pci", "usb", "scsi", "virtio", "nvme", "platform", "acpi", "hid", "i2c", "spi", "mmc", "sdio", "xen",
+    "serio", "pnp", "Serial ATA", "NVM Express", "Universal Serial Bus", "PCI Express",
+};
+
+static void BM_bus_cast_legacy(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_bus_cast(buses[i++ % buses.size()]));
+    }
+}
+BENCHMARK(BM_bus_cast_legacy)->Unit(benchmark::kMicrosecond);
+
+static void BM_bus_cast(benchmark::State& state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(probe::bus_cast(buses[i++ % buses.size()]));
+    }
+}
+BENCHMARK(BM_bus_cast)->Unit(benchmark::kMicrosecond);
@@ -1,9 +1,67 @@
 #include "probe/cpu.h"
-
+#include "probe/numa.h"
 #include "probe/util.h"
 
+#include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PROBE_EXAMPLE_X86
+#include <immintrin.h>
+#endif
+
+// the kernels of the dispatch example
+static float sum_scalar(const float *data, size_t size)
+{
+    float sum = 0;
+    for (size_t i = 0; i < size; ++i) sum += data[i];
+    return sum;
+}
+
+#ifdef PROBE_EXAMPLE_X86
+#if defined(__GNUC__)
+__attribute__((target("avx2")))
+#endif
+static float sum_avx2(const float *data, size_t size)
+{
+    __m256 acc = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, acc);
+
+    float sum = 0;
+    for (const auto lane : lanes) sum += lane;
+    for (; i < size; ++i) sum += data[i];
+    return sum;
+}
+#endif
+
+// resolved once, when the program is loaded
+static const probe::cpu::dispatch<float(const float *, size_t)> sum{
+#ifdef PROBE_EXAMPLE_X86
+    { { probe::cpu::feature_t::avx, probe::cpu::feature_t::avx2 }, sum_avx2 },
+#endif
+    { {}, sum_scalar },
+};
+
+// average time of a call, in microseconds
+template<typename F> static double measure(F&& fn, const std::vector<float>& data)
+{
+    constexpr int rounds = 100;
+
+    volatile float sink  = 0;
+    const auto     start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) sink = sink + fn(data.data(), data.size());
+
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+           rounds;
+}
 
 int main()
 {
@@ -50,5 +108,46 @@ int main()
         std::cout << "    L3               : " << std::setw(2) << l3.size() << " x " << std::setw(4)
                   << probe::util::MB(l3[0].size) << " MB\n";
 
+#ifdef __linux__
+    // topology
+    const auto topology = probe::cpu::topology();
+    std::cout << "\nCPU Topology: \n"
+              << "    Packages         : " << topology->packages << '\n'
+              << "    Dies             : " << topology->dies << '\n'
+              << "    Cores            : " << topology->cores << '\n'
+              << "    Threads          : " << topology->threads << '\n'
+              << "    SMT              : " << topology->smt << '\n'
+              << "    NUMA Nodes       : " << topology->nodes << '\n'
+              << "    Online           : " << probe::to_string(topology->online) << '\n'
+              << "    Offline          : " << probe::to_string(topology->offline) << '\n';
+
+    // NUMA
+    for (const auto& node : probe::numa::nodes()) {
+        std::cout << "\nNUMA Node " << node.id << ": \n"
+                  << "    CPUs             : " << probe::to_string(node.cpus) << '\n'
+                  << "    Memory           : " << probe::util::GB(node.free) << " / "
+                  << probe::util::GB(node.total) << " GB\n"
+                  << "    Distances        :";
+        for (const auto distance : node.distances) std::cout << ' ' << distance;
+        std::cout << '\n';
+    }
+#endif
+
+    // dispatch
+    std::vector<float> data(1 << 20);
+    std::iota(data.begin(), data.end(), 0.0f);
+    for (auto& value : data) value = value / static_cast<float>(data.size());
+
+#ifdef PROBE_EXAMPLE_X86
+    const char *variant = sum.get() == sum_avx2 ? "avx2" : "scalar";
+#else
+    const char *variant = "scalar";
+#endif
+
+    std::cout << "\nDispatch: \n"
+              << "    Sum              : " << variant << '\n'
+              << "    Dispatched       : " << std::setw(8) << measure(sum, data) << " us\n"
+              << "    Scalar           : " << std::setw(8) << measure(sum_scalar, data) << " us\n";
+
     return 0;
 }
\ No newline at end of file
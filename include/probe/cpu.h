@@ -4,8 +4,16 @@
 #include "probe/dllport.h"
 #include "probe/types.h"
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace probe::cpu
@@ -40,6 +48,43 @@ namespace probe::cpu
         uint32_t packages{};
     };
 
+    // a set of logical processors, the processor i is the bit (i % 64) of words[i / 64]
+    struct cpuset_t
+    {
+        std::vector<uint64_t> words{};
+
+        bool test(size_t cpu) const { return cpu / 64 < words.size() && (words[cpu / 64] >> (cpu % 64)) & 1; }
+
+        void set(size_t cpu)
+        {
+            if (cpu / 64 >= words.size()) words.resize(cpu / 64 + 1);
+            words[cpu / 64] |= uint64_t{ 1 } << (cpu % 64);
+        }
+
+        void reset(size_t cpu)
+        {
+            if (cpu / 64 < words.size()) words[cpu / 64] &= ~(uint64_t{ 1 } << (cpu % 64));
+        }
+
+        size_t count() const
+        {
+            size_t n = 0;
+            for (const auto word : words) n += std::popcount(word);
+            return n;
+        }
+
+        bool empty() const { return std::ranges::all_of(words, [](auto word) { return word == 0; }); }
+
+        // the processors in ascending order
+        PROBE_API std::vector<size_t> cpus() const;
+
+        // the trailing zero words are ignored
+        PROBE_API bool operator==(const cpuset_t&) const;
+    };
+
+    // parses the cpu list format of the Linux kernel, e.g. "0-3,8,10-11"
+    PROBE_API cpuset_t to_cpuset(std::string_view);
+
     struct cpu_info_t
     {
         std::string    name{};
@@ -67,6 +112,7 @@ namespace probe::cpu
         uint64_t     line_size{};
         uint64_t     size{};
         cache_type_t type{};
+        cpuset_t     shared{}; // the processors sharing the cache
     };
 
     PROBE_API architecture_t architecture();
@@ -95,6 +141,9 @@ namespace probe::cpu
     // cpuid
     PROBE_API void cpuid(int32_t (&)[4], int32_t, int32_t);
 
+    // the extended control register, requires osxsave
+    PROBE_API uint64_t xgetbv(uint32_t);
+
     // clang-format off
     enum class feature_t : uint64_t
     {
@@ -319,12 +368,251 @@ namespace probe::cpu
     };
     // clang-format on
 
+    // the cpuid registers that the features are defined in, {leaf, subleaf, register(EAX, EBX, ECX, EDX)}
+    struct feature_register_t
+    {
+        uint32_t leaf{};
+        uint32_t subleaf{};
+        uint32_t reg{};
+    };
+
+    // clang-format off
+    inline constexpr feature_register_t feature_registers[] = {
+        { 0x0000'0001, 0, 2 },
+        { 0x0000'0001, 0, 3 },
+        { 0x0000'0007, 0, 1 },
+        { 0x0000'0007, 0, 2 },
+        { 0x0000'0007, 0, 3 },
+        { 0x0000'0007, 1, 0 },
+        { 0x0000'0007, 1, 3 },
+        { 0x0000'000D, 1, 0 },
+        { 0x0000'0019, 0, 1 },
+        { 0x8000'0001, 0, 2 },
+        { 0x8000'0001, 0, 3 },
+    };
+    // clang-format on
+
+    // the bit index of the feature in a feature_set_t, -1 if the register is not listed above
+    constexpr int32_t feature_index(feature_t feature)
+    {
+        const auto value = static_cast<uint64_t>(feature);
+        const auto bit   = static_cast<int32_t>(value & 0x1f);
+
+        for (size_t i = 0; i < std::size(feature_registers); ++i) {
+            const auto& reg = feature_registers[i];
+
+            if (reg.leaf == (value >> 32) && reg.subleaf == ((value >> 24) & 0xff) &&
+                reg.reg == ((value >> 16) & 0xff))
+                return static_cast<int32_t>(i) * 32 + bit;
+        }
+        return -1;
+    }
+
+    // the features packed into one bit each, the words are the raw cpuid registers.
+    // can be built at compile time, e.g. the features required by a dispatch table entry
+    struct feature_set_t
+    {
+        uint32_t words[std::size(feature_registers)]{};
+
+        constexpr feature_set_t() = default;
+
+        constexpr feature_set_t(std::initializer_list<feature_t> features)
+        {
+            for (const auto feature : features) set(feature);
+        }
+
+        constexpr void set(feature_t feature)
+        {
+            if (const auto i = feature_index(feature); i >= 0) words[i / 32] |= uint32_t{ 1 } << (i % 32);
+        }
+
+        constexpr bool has(feature_t feature) const
+        {
+            const auto i = feature_index(feature);
+            return i >= 0 && (words[i / 32] >> (i % 32)) & 1;
+        }
+
+        // all the features of the other set are in this set
+        constexpr bool contains(const feature_set_t& other) const
+        {
+            for (size_t i = 0; i < std::size(words); ++i) {
+                if ((words[i] & other.words[i]) != other.words[i]) return false;
+            }
+            return true;
+        }
+
+        constexpr bool empty() const
+        {
+            for (const auto word : words) {
+                if (word) return false;
+            }
+            return true;
+        }
+
+        constexpr feature_set_t operator|(const feature_set_t& other) const
+        {
+            feature_set_t ret{ *this };
+            for (size_t i = 0; i < std::size(words); ++i) ret.words[i] |= other.words[i];
+            return ret;
+        }
+
+        constexpr bool operator==(const feature_set_t&) const = default;
+    };
+
     PROBE_API std::tuple<int32_t, int32_t, int32_t, int32_t> unpack(feature_t);
 
+    // the features of the processor, cpuid is executed once, on the first call, and thread-safe.
+    // the AVX, AVX-512 and AMX features are dropped if the OS does not save their registers (XCR0)
+    PROBE_API const feature_set_t& features();
+
+    // O(1), looked up in features()
+    inline bool has(feature_t feature) { return features().has(feature); }
+
+    // the features filtered by the vendor, built once from features()
     PROBE_API std::vector<feature_t> instruction_sets();
 
     PROBE_API bool is_supported(feature_t);
+
+    template<typename F> class dispatch;
+
+    // runtime dispatch between the variants of a function, each tagged with the features it requires.
+    // the variants are listed from the most to the least demanding, the first one supported by features()
+    // is resolved once, by the constructor, so a call is a single indirect call. e.g.
+    //
+    //   static const dispatch<float(const float *, size_t)> sum{
+    //       { { feature_t::avx2 }, sum_avx2 },
+    //       { {}, sum_scalar },
+    //   };
+    template<typename R, typename... Args> class dispatch<R(Args...)>
+    {
+    public:
+        using function_t = R (*)(Args...);
+
+        struct variant_t
+        {
+            feature_set_t features{};
+            function_t    function{};
+        };
+
+        dispatch(std::initializer_list<variant_t> variants)
+            : function_(select(variants, features()))
+        {}
+
+        // the first variant whose features are all in the set, nullptr if none
+        static constexpr function_t select(std::initializer_list<variant_t> variants,
+                                           const feature_set_t& supported)
+        {
+            for (const auto& variant : variants) {
+                if (supported.contains(variant.features)) return variant.function;
+            }
+            return nullptr;
+        }
+
+        R operator()(Args... args) const { return function_(std::forward<Args>(args)...); }
+
+        function_t get() const { return function_; }
+
+        explicit operator bool() const { return function_ != nullptr; }
+
+    private:
+        function_t function_{};
+    };
+} // namespace probe::cpu
+
+#ifdef __linux__
+namespace probe::cpu
+{
+    // /sys/devices/system/cpu/cpu<N>/topology
+    struct processor_t
+    {
+        uint32_t id{};       // logical processor number
+        int32_t  package{};  // physical_package_id, -1 if unknown
+        int32_t  die{};      // die_id, -1 if unknown
+        int32_t  cluster{};  // cluster_id, -1 if unknown
+        int32_t  core{};     // core_id, -1 if unknown
+        int32_t  node{ -1 }; // NUMA node, -1 if unknown
+        bool     online{};
+        cpuset_t siblings{}; // SMT siblings sharing the core, including itself
+    };
+
+    struct topology_t
+    {
+        std::vector<processor_t> processors{}; // the present processors, sorted by the id
+
+        cpuset_t online{};
+        cpuset_t offline{}; // present, but offline
+
+        // counted over the online processors
+        uint32_t packages{};
+        uint32_t dies{};
+        uint32_t cores{};
+        uint32_t threads{};
+        uint32_t nodes{};
+
+        // the maximum number of SMT siblings per core
+        uint32_t smt{};
+    };
+
+    // reads a file in the cpu list format, e.g. /sys/devices/system/cpu/online, opened by openat(2) relative
+    // to the directory descriptor, into the caller-owned buffer. empty if failed
+    PROBE_API cpuset_t read_cpuset(int, const char *, std::span<char>);
+
+    // the topology of the present processors, read from sysfs by the first call and shared by the later
+    // ones without copying, all files are opened relative to one directory. refresh reads it again, e.g.
+    // after a processor hotplug, the snapshots returned before are left unchanged
+    PROBE_API std::shared_ptr<const topology_t> topology(bool refresh = false);
+
+    struct core_usage_t
+    {
+        uint32_t id{};        // logical processor number
+        double   usage{};     // %, busy time, everything but idle and iowait
+        double   user{};      // %, user + nice
+        double   system{};    // %
+        double   iowait{};    // %
+        double   irq{};       // %, irq + softirq
+        double   steal{};     // %, stolen by the hypervisor
+        uint64_t frequency{}; // Hz, cpufreq/scaling_cur_freq, 0 if unavailable
+    };
+
+    // per-processor utilisation between two samples of /proc/stat, and the current frequencies
+    //  - the files are kept open and re-read by pread(2), the buffers are reused by each sample
+    //  - the tick counts are indexed by the processor number, the processors brought online since
+    //    the previous sample are not reported
+    class sampler
+    {
+    public:
+        PROBE_API sampler();
+        PROBE_API ~sampler();
+
+        sampler(const sampler&)            = delete;
+        sampler& operator=(const sampler&) = delete;
+
+        // returns the usage of every online processor since the previous sample, empty for the first
+        // sample. the result is reused and only valid until the next sample
+        PROBE_API const std::vector<core_usage_t>& sample();
+
+    private:
+        struct ticks_t
+        {
+            bool     valid{};
+            uint64_t busy{};
+            uint64_t user{};
+            uint64_t system{};
+            uint64_t idle{};
+            uint64_t iowait{};
+            uint64_t irq{};
+            uint64_t steal{};
+        };
+
+        int                       stat_{ -1 };
+        std::vector<int>          freqs_{}; // scaling_cur_freq, -1 if unavailable, -2 if not opened yet
+        std::vector<char>         buffer_{};
+        std::vector<ticks_t>      prev_{};
+        std::vector<ticks_t>      curr_{};
+        std::vector<core_usage_t> usages_{};
+    };
 } // namespace probe::cpu
+#endif
 
 namespace probe
 {
@@ -332,6 +620,9 @@ namespace probe
     PROBE_API std::string to_string(cpu::endianness_t);
     PROBE_API std::string to_string(cpu::feature_t);
     PROBE_API std::string to_string(cpu::cache_type_t);
+
+    // in the cpu list format, e.g. "0-3,8,10-11"
+    PROBE_API std::string to_string(const cpu::cpuset_t&);
 } // namespace probe
 
 #endif //! PROBE_CPU_H
\ No newline at end of file
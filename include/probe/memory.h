@@ -2,21 +2,60 @@
 #define PROBE_MEMORY_H
 
 #include "probe/dllport.h"
+#include "probe/smbios.h"
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace probe::memory
 {
+    // pressure stall information, the share of the wall time in which tasks stalled on memory
+    struct pressure_t
+    {
+        double   avg10{};  // %, averaged over 10 seconds
+        double   avg60{};  // %, averaged over 60 seconds
+        double   avg300{}; // %, averaged over 300 seconds
+        uint64_t total{};  // us, the accumulated stall time
+    };
+
     struct memory_status_t
     {
-        uint64_t avail{}; // bytes
+        uint64_t avail{}; // bytes, linux: MemAvailable, the estimate including the reclaimable caches
         uint64_t total{}; // bytes
+
+        // linux only, /proc/meminfo
+        uint64_t free{};             // bytes, MemFree, completely unused
+        uint64_t buffers{};          // bytes
+        uint64_t cached{};           // bytes, page cache
+        uint64_t dirty{};            // bytes, waiting to be written back
+        uint64_t writeback{};        // bytes, being written back
+        uint64_t slab{};             // bytes, kernel data structures
+        uint64_t slab_reclaimable{}; // bytes
+        uint64_t swap_total{};       // bytes
+        uint64_t swap_free{};        // bytes
+        uint64_t swap_cached{};      // bytes
+        uint64_t hugepages_total{};  // pages
+        uint64_t hugepages_free{};   // pages
+        uint64_t hugepage_size{};    // bytes
+
+        // linux only, /proc/pressure/memory, requires CONFIG_PSI
+        pressure_t some{}; // at least one task stalled
+        pressure_t full{}; // all non-idle tasks stalled simultaneously
     };
 
     PROBE_API memory_status_t status();
 
+#ifdef __linux__
+    // parses the text of /proc/meminfo by a single pass, without allocation
+    PROBE_API bool parse_meminfo(std::string_view, memory_status_t&);
+
+    // parses the text of /proc/pressure/memory
+    PROBE_API bool parse_pressure(std::string_view, memory_status_t&);
+#endif
+
     enum class memory_type_t
     {
         Other                      = 0x01,
@@ -68,6 +107,7 @@ namespace probe::memory
     // SMBIOS, Memory Device(Type 17)
     struct MemoryDevice
     {
+        uint16_t      Handle{};
         uint16_t      PhysicalMemeoryArrayHandle{};
         uint16_t      MemoryErrorInformationHandle{};
         uint16_t      TotalWidth{}; // bits
@@ -109,6 +149,15 @@ namespace probe::memory
     PROBE_API std::vector<MemoryDevice> devices();
 
     PROBE_API std::vector<PhysicalMemoryArray> physical_device_arrays();
+
+    // decoders of the SMBIOS structures, for SMBIOS 2.1 through 3.7
+    // the fields introduced after the version of the structure (by its length) are left zero
+    PROBE_API PhysicalMemoryArray to_physical_memory_array(const smbios::structure_t&);
+    PROBE_API MemoryDevice        to_memory_device(const smbios::structure_t&);
+
+    // decodes all the Memory Devices / Physical Memory Arrays of a DMI blob, e.g. a mapped dump
+    PROBE_API std::vector<MemoryDevice>        devices(std::span<const uint8_t>);
+    PROBE_API std::vector<PhysicalMemoryArray> physical_device_arrays(std::span<const uint8_t>);
 } // namespace probe::memory
 
 #endif //! PROBE_MEMORY_H
\ No newline at end of file
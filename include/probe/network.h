@@ -4,10 +4,19 @@
 #include "probe/dllport.h"
 #include "probe/types.h"
 
+#include <cstdint>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#ifdef __linux__
+#include <atomic>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <thread>
+#endif
+
 namespace probe::network
 {
     enum class if_type_t
@@ -100,6 +109,8 @@ namespace probe::network
         std::string              dns_suffix{};
         std::vector<std::string> ipv4_dns_servers{};
         std::vector<std::string> ipv6_dns_servers{};
+
+        bool operator==(const adapter_t&) const = default;
     };
 
     // Windows: The hostname for the local computer. This may be the fully qualified hostname (including the
@@ -111,21 +122,253 @@ namespace probe::network
     struct traffic_status_t
     {
         std::string guid{};          // interface guid
+        std::string name{};          // linux: interface name
+        uint32_t    index{};         // interface index
 
         uint64_t ibytes{};           // bytes
         uint64_t obytes{};           // bytes
 
-        uint64_t unicast_ibytes{};   // bytes
-        uint64_t unicast_obytes{};   // bytes
+        uint64_t ipackets{};         // packets
+        uint64_t opackets{};         // packets
+
+        uint64_t idrops{};           // packets, discarded
+        uint64_t odrops{};           // packets, discarded
+
+        uint64_t ierrors{};          // packets
+        uint64_t oerrors{};          // packets
 
-        uint64_t broadcast_ibytes{}; // bytes
-        uint64_t broadcast_obytes{}; // bytes
+        uint64_t unicast_ibytes{};   // bytes, Windows
+        uint64_t unicast_obytes{};   // bytes, Windows
 
-        uint64_t multicast_ibytes{}; // bytes
-        uint64_t multicast_obytes{}; // bytes
+        uint64_t broadcast_ibytes{}; // bytes, Windows
+        uint64_t broadcast_obytes{}; // bytes, Windows
+
+        uint64_t multicast_ibytes{}; // bytes, Windows
+        uint64_t multicast_obytes{}; // bytes, Windows
     };
 
+    // linux: rtnetlink RTM_GETLINK stats64, or /sys/class/net/<name>/statistics
     PROBE_API traffic_status_t status(const adapter_t&);
+
+#ifdef __linux__
+    struct traffic_rate_t
+    {
+        std::string name{};
+        uint32_t    index{};
+
+        double ibytes{};   // bytes/s
+        double obytes{};   // bytes/s
+        double ipackets{}; // packets/s
+        double opackets{}; // packets/s
+        double idrops{};   // packets/s
+        double odrops{};   // packets/s
+        double ierrors{};  // packets/s
+        double oerrors{};  // packets/s
+    };
+
+    // the traffic rates of all interfaces between two samples
+    //  - the counters of all interfaces are dumped by one rtnetlink round trip on a persistent socket
+    //  - the counters are kept sorted by the interface index, the tables are swapped by each sample
+    //  - the interfaces created since the previous sample are not reported
+    class traffic_sampler
+    {
+    public:
+        PROBE_API traffic_sampler();
+        PROBE_API ~traffic_sampler();
+
+        traffic_sampler(const traffic_sampler&)            = delete;
+        traffic_sampler& operator=(const traffic_sampler&) = delete;
+
+        // returns the rates of every interface since the previous sample, empty for the first sample.
+        // the result is reused and only valid until the next sample
+        PROBE_API const std::vector<traffic_rate_t>& sample();
+
+    private:
+        int                           fd_{ -1 };
+        uint32_t                      seq_{};
+        std::vector<char>             buffer_{};
+        std::vector<traffic_status_t> prev_{};
+        std::vector<traffic_status_t> curr_{};
+        std::vector<traffic_rate_t>   rates_{};
+        uint64_t                      time_{}; // ns, relative_time() of the previous sample
+    };
+
+    enum class adapter_event_type_t
+    {
+        added,
+        changed, // flags, mtu, name or the hardware address, e.g. the interface goes up or down
+        removed,
+        address_added,
+        address_removed,
+    };
+
+    struct adapter_event_t
+    {
+        adapter_event_type_t type{};
+        uint32_t             index{};   // interface index
+        adapter_t            adapter{}; // the adapter after the change, or the last state if removed
+        std::string          address{}; // IPv4 "<address>", IPv6 "<address>/<prefix length>"
+    };
+
+    // listens the link and address changes by the rtnetlink multicast groups, and calls the callback with
+    // an adapter_event_t on the listening thread
+    //  - listen(groups, callback): the RTMGRP_* mask as uint32_t, or an empty std::any for
+    //    RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR
+    //  - the adapters are snapshotted once by listen(), and kept up to date by the events. the gateways,
+    //    DHCP and DNS are those of the snapshot, and dhcp_enabled is not cleared by a removed address
+    //  - if the socket buffer overruns, the adapters are dumped again, and the ones added, removed or
+    //    differing from their previous state are reported
+    class NetlinkListener final : public Listener
+    {
+    public:
+        PROBE_API ~NetlinkListener() override { stop(); }
+
+        // return 0 on success, or the error number
+        PROBE_API int  listen(const std::any&, const std::function<void(const std::any&)>&) override;
+        PROBE_API void stop() override;
+
+        PROBE_API bool running() override { return running_; }
+
+    private:
+        int               fd_{ -1 };
+        int               event_{ -1 }; // eventfd, wakes up the listening thread to stop
+        std::jthread      thread_{};
+        std::atomic<bool> running_{ false };
+    };
+
+    enum class socket_protocol_t
+    {
+        tcp,
+        udp,
+        unix_domain,
+    };
+
+    // the TCP_* states in <netinet/tcp.h>, UDP and Unix sockets are established, listen or close
+    enum class socket_state_t
+    {
+        unknown,
+        established,
+        syn_sent,
+        syn_recv,
+        fin_wait1,
+        fin_wait2,
+        time_wait,
+        close,
+        close_wait,
+        last_ack,
+        listen,
+        closing,
+        new_syn_recv,
+    };
+
+    struct socket_t
+    {
+        socket_protocol_t protocol{};
+        int               family{}; // AF_INET, AF_INET6 or AF_UNIX
+        int               type{};   // SOCK_STREAM, SOCK_DGRAM or SOCK_SEQPACKET
+        socket_state_t    state{};
+
+        std::string local_address{};  // IP address, or the path of Unix socket, '@' for the abstract names
+        uint16_t    local_port{};
+        std::string remote_address{}; // IP address
+        uint16_t    remote_port{};
+
+        uint64_t inode{};
+        uint64_t peer{};   // Unix: the inode of the peer
+        uint32_t uid{};    // Unix: since Linux 5.3
+        uint32_t rqueue{}; // bytes, listening: the pending connections
+        uint32_t wqueue{}; // bytes, listening: the backlog
+
+        uint32_t rtt{};         // us, TCP
+        uint32_t rttvar{};      // us, TCP
+        uint32_t cwnd{};        // segments, TCP
+        uint32_t retransmits{}; // segments, TCP, the total retransmits
+
+        int64_t pid{ -1 }; // the owner process as process_t::pid, -1 if not resolved
+    };
+
+    // the states and ports are filtered by the kernel
+    struct socket_filter_t
+    {
+        bool     tcp{ true };
+        bool     udp{ true };
+        bool     unix_domain{ true };
+        uint32_t states{ ~0u };  // the mask of (1 << socket_state_t)
+        uint16_t local_port{};   // 0 for any, the Unix sockets are excluded if a port is specified
+        uint16_t remote_port{};  // 0 for any
+        bool     tcp_info{ true };
+        bool     owners{ false }; // resolves the pids by /proc/<pid>/fd, only the visible processes
+    };
+
+    // the sockets dumped by NETLINK_SOCK_DIAG, inet_diag and unix_diag
+    PROBE_API std::vector<socket_t> sockets(const socket_filter_t& = {});
+
+    // streaming without the vector, the socket is reused and only valid in the callback, return false to
+    // stop. return 0 on success, or the error number if none of the requested dumps succeeded, the
+    // protocols whose diag module is not loaded, e.g. udp_diag, are skipped while another one succeeds
+    PROBE_API int sockets(const socket_filter_t&, const std::function<bool(const socket_t&)>&);
+
+    struct route_t
+    {
+        int         family{};      // AF_INET or AF_INET6
+        std::string destination{}; // "0.0.0.0" or "::" for the default route
+        uint8_t     prefix{};      // prefix length
+        std::string gateway{};     // empty if directly connected
+        std::string source{};      // the preferred source address
+        uint32_t    index{};       // the output interface index
+        std::string name{};        // the output interface name
+        uint32_t    metric{};
+        uint32_t    table{};       // 254: main, 255: local
+        uint8_t     protocol{};    // RTPROT_*, e.g. 2: kernel, 3: boot, 4: static, 16: dhcp
+        uint8_t     scope{};       // RT_SCOPE_*, e.g. 0: universe, 253: link, 254: host
+        uint8_t     type{};        // RTN_*, e.g. 1: unicast, 2: local, 6: blackhole, 7: unreachable
+    };
+
+    // the routes of the table dumped by RTM_GETROUTE, 0 for all tables
+    // the multipath routes are reported as a route per next hop
+    PROBE_API std::vector<route_t> routes(uint32_t table = 254);
+
+    // longest prefix match by a binary trie per family, the lower metric wins on the same prefix.
+    // the policy routing rules are not considered, build it with the routes of one table
+    class route_table
+    {
+    public:
+        route_table() = default;
+        PROBE_API explicit route_table(const std::vector<route_t>&);
+
+        // return false if the destination is not an IP address
+        PROBE_API bool insert(const route_t&);
+
+        // the route to the destination address, nullptr if no route matches or not an IP address
+        PROBE_API const route_t *lookup(std::string_view) const;
+
+        // the address in the network byte order, 4 bytes for AF_INET or 16 bytes for AF_INET6
+        PROBE_API const route_t *lookup(int family, std::span<const uint8_t>) const;
+
+        size_t size() const { return routes_.size(); }
+
+    private:
+        struct node_t
+        {
+            int32_t next[2]{ -1, -1 };
+            int32_t route{ -1 }; // index of routes_
+        };
+
+        std::vector<node_t>  v4_{ 1 }; // the root is the default route
+        std::vector<node_t>  v6_{ 1 };
+        std::vector<route_t> routes_{};
+    };
+
+    // resolv.conf(5)
+    struct resolver_t
+    {
+        std::vector<std::string> ipv4_servers{};
+        std::vector<std::string> ipv6_servers{};
+        std::vector<std::string> search{}; // the search list, or the local domain
+    };
+
+    PROBE_API resolver_t parse_resolv_conf(std::string_view);
+#endif
 } // namespace probe::network
 
 namespace probe
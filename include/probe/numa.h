@@ -0,0 +1,65 @@
+#ifdef __linux__
+
+#ifndef PROBE_NUMA_H
+#define PROBE_NUMA_H
+
+#include "probe/cpu.h"
+#include "probe/dllport.h"
+
+#include <cstdint>
+#include <vector>
+
+// https://www.kernel.org/doc/html/latest/admin-guide/mm/numaperf.html
+//
+// /sys/devices/system/node
+//   - online               : the online nodes, in the cpu list format
+//   - node<N>/cpulist      : the processors of the node
+//   - node<N>/meminfo      : the memory of the node, "Node <N> MemTotal: <kB> kB"
+//   - node<N>/distance     : the relative distances to the online nodes, 10 for the local node
+namespace probe::numa
+{
+    struct node_t
+    {
+        uint32_t              id{};
+        cpu::cpuset_t         cpus{};
+        uint64_t              total{};     // bytes, MemTotal
+        uint64_t              free{};      // bytes, MemFree
+        std::vector<uint32_t> distances{}; // to the online nodes, in the order of nodes()
+    };
+
+    // the online nodes sorted by the id, empty if the kernel is built without NUMA
+    PROBE_API std::vector<node_t> nodes();
+
+    // the specific node, only the id is set if the node is not online
+    PROBE_API node_t node(uint32_t);
+
+    // distances()[i][j] is the relative distance from the i-th to the j-th online node
+    PROBE_API std::vector<std::vector<uint32_t>> distances();
+
+    // the node of each present processor, indexed by the processor number, -1 if the processor has no node.
+    // taken from the cached cpu::topology()
+    PROBE_API std::vector<int32_t> cpu_nodes();
+
+    // the node of the processor, -1 if unknown, looked up in the cached cpu::topology()
+    PROBE_API int32_t node_of(uint32_t cpu);
+
+    // the node the calling thread is running on, -1 if unknown
+    PROBE_API int32_t current_node();
+
+    // pins the calling thread to the processors of the node, the memory allocated by the thread
+    // afterwards is local to the node under the default policy
+    // return 0 on success, or the error number
+    PROBE_API int run_on_node(uint32_t);
+
+    // binds the memory allocated by the calling thread afterwards to the node, set_mempolicy(MPOL_BIND),
+    // the allocations fail instead of falling back to the other nodes.
+    // return 0 on success, or the error number, e.g. EINVAL if the node is not online
+    PROBE_API int bind_memory(uint32_t);
+
+    // restores the default policy of the calling thread, the memory is allocated on the local node
+    PROBE_API int unbind_memory();
+} // namespace probe::numa
+
+#endif //! PROBE_NUMA_H
+
+#endif
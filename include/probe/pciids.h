@@ -2362,6 +2362,2281 @@ V(0xfffd,"XenSource, Inc.")\
 V(0xfffe,"VMWare Inc (temporary ID)")\
 V(0xffff,"Illegal Vendor ID")\
 
+#define PCIIDS_VENDOR_NAMES \
+N("21st century computer corp.",0x21c3)\
+N("2wire inc",0x156b)\
+N("3a international, inc.",0x12ec)\
+N("3com (wrong id)",0x9850)\
+N("3com corp, modem division",0x12b9)\
+N("3com corporation",0x10b7)\
+N("3cx",0x14e7)\
+N("3d labs",0x1115)\
+N("3d vision(???)",0x2a15)\
+N("3dfx interactive, inc.",0x121a)\
+N("3dlabs",0x3d3d)\
+N("3do company",0x1239)\
+N("3leaf systems, inc.",0x1a1e)\
+N("3snic ltd",0x1f3f)\
+N("3ware inc",0x13c1)\
+N("4links",0x38ef)\
+N("?young micro systems",0x1052)\
+N("a-logics",0x1999)\
+N("a-max technology co ltd",0x159e)\
+N("a-trend technology",0x117a)\
+N("a-trend technology co ltd",0x1563)\
+N("a.p.d., s.a.",0x1245)\
+N("aashima technology b.v.",0x145e)\
+N("ab semiconductor ltd",0x1309)\
+N("abaco systems inc.",0x1d92)\
+N("abaco systems, inc.",0x140b)\
+N("abb network partner ab",0x135d)\
+N("abb power systems",0x125a)\
+N("abb robotics products ab",0x13de)\
+N("abit computer corp.",0x147b)\
+N("abocom systems inc",0x13d1)\
+N("absolute analysis",0x1b79)\
+N("acc microelectronics",0x10aa)\
+N("accelecom",0x1f60)\
+N("accelerated encryption",0x172a)\
+N("accelerix inc",0x130d)\
+N("accelgraphics inc.",0x1040)\
+N("accensus, llc",0x1c3b)\
+N("acces i/o products, inc.",0x494f)\
+N("accton technology corporation",0x1113)\
+N("accusys inc",0x14d6)\
+N("acer incorporated [ali]",0x1025)\
+N("achme computer, inc.",0x10f2)\
+N("acksys",0x1528)\
+N("acqis technology inc",0x1530)\
+N("acromag, inc.",0x16d5)\
+N("acrox technologies co., ltd.",0x0f62)\
+N("actel",0x11aa)\
+N("actiontec electronics inc",0x1668)\
+N("actis computer",0x1536)\
+N("actuality systems",0xac3d)\
+N("acuity imaging, inc",0x1312)\
+N("aculab plc",0x12d9)\
+N("ad lib multimedia inc",0x13f8)\
+N("adaptec",0x9004)\
+N("adaptec (formerly dpt)",0x1044)\
+N("adaptive solutions",0x120b)\
+N("adata technology co., ltd.",0x1cc1)\
+N("adax, inc.",0x126b)\
+N("addi-data gmbh",0x15b8)\
+N("addonics",0x1413)\
+N("addtron technology co, inc.",0x4033)\
+N("adlink technology",0x144a)\
+N("admtek",0x1317)\
+N("adnaco technology inc.",0xaaaa)\
+N("adobe systems, inc",0x1173)\
+N("adrienne electronics corporation",0xaecb)\
+N("ads technologies inc",0x1421)\
+N("adtek system science co ltd",0x136c)\
+N("adtran",0x1238)\
+N("advance multimedia internet technology, inc.",0x18eb)\
+N("advanced hardware architectures",0x1456)\
+N("advanced integrations research",0x1075)\
+N("advanced logic research",0x10bc)\
+N("advanced micro devices, inc. [amd/ati]",0x1002)\
+N("advanced micro devices, inc. [amd]",0x1022)\
+N("advanced mos technology inc",0x14aa)\
+N("advanced peripherals labs",0x10d8)\
+N("advanced peripherals technologies",0x1164)\
+N("advanced system products, inc",0x10cd)\
+N("advanced technology laboratories, inc.",0x1187)\
+N("advanced telecommunications modules",0x121b)\
+N("advanet inc",0x130f)\
+N("advantech co. ltd",0x13fe)\
+N("advantech co., ltd.",0x16da)\
+N("advantest corporation",0x1850)\
+N("advent design",0x1515)\
+N("aeg electrocom gmbh",0x124a)\
+N("aeroflex",0x146a)\
+N("aeroflex gaisler",0x1ac8)\
+N("aerotech, inc.",0x1d7c)\
+N("aethra s.r.l.",0x139f)\
+N("afavlab technology inc",0x14db)\
+N("ag communications",0x14f9)\
+N("ag electronics ltd",0x15cb)\
+N("ageia technologies, inc.",0x1971)\
+N("agere inc",0x15e6)\
+N("agie ltd",0x1441)\
+N("agilent technologies",0x14ec)\
+N("aha products group",0x193f)\
+N("aim gmbh",0x1447)\
+N("aims lab",0x12cd)\
+N("aja video",0xf1d0)\
+N("akitio",0x1cf0)\
+N("alacritech inc",0x139a)\
+N("alacron",0x1096)\
+N("aladdin knowledge systems",0x416c)\
+N("alaris, inc.",0x10f3)\
+N("albatron corp.",0x17f2)\
+N("alcatel",0x1064)\
+N("alcatel-lucent",0x1846)\
+N("alco digital devices limited",0x1dc2)\
+N("alcor micro",0x1aea)\
+N("ald technology ltd",0x13ae)\
+N("alesis studio electronics",0x1448)\
+N("alfa inc",0x156e)\
+N("alfa, inc.",0x1178)\
+N("algo system co ltd",0x134f)\
+N("algol corp.",0x1440)\
+N("alibaba (china) co., ltd.",0x1ded)\
+N("allen-bradley company",0x12a0)\
+N("alliance semiconductor corp.",0x5301)\
+N("alliance semiconductor corporation",0x1142)\
+N("allied data technologies",0x158b)\
+N("allied telesis",0x1259)\
+N("allied telesis, inc (wrong id)",0x0010)\
+N("allo",0x1d21)\
+N("allwinmeta co., ltd.",0x1fe0)\
+N("aloka co. ltd",0x1408)\
+N("alpha data",0x4144)\
+N("alpha networks inc.",0x1948)\
+N("alpha-top corp",0x156d)\
+N("alphi technology corp",0x13c5)\
+N("alps electric co., ltd.",0x10e9)\
+N("alta data technologies llc",0xad00)\
+N("alta technology corporation",0x1237)\
+N("alteon networks inc.",0x12ae)\
+N("altera corporation",0x1172)\
+N("altiga networks",0x1454)\
+N("altima (nee broadcom)",0x173b)\
+N("altos india ltd",0x10f8)\
+N("amazon.com, inc.",0x1d0f)\
+N("ambex technologies, inc",0x130c)\
+N("ambicom inc",0x1395)\
+N("ambient technologies inc",0x1813)\
+N("ambit microsystem corp.",0x1468)\
+N("ambric inc.",0x1a22)\
+N("amd pensando systems",0x1dd8)\
+N("amdahl corporation",0x1206)\
+N("american megatrends inc.",0x101e)\
+N("amersham pharmacia biotech",0x15ae)\
+N("amlogic inc",0x143c)\
+N("ammasso",0x18b8)\
+N("amo gmbh",0x12a7)\
+N("amp, inc",0x1038)\
+N("ampere computing, llc",0x1def)\
+N("ample communications, inc",0x188a)\
+N("amplicon liveline ltd",0x14dc)\
+N("amtek",0x1897)\
+N("amtelco",0x14e3)\
+N("analog devices",0x11d4)\
+N("analogic corp",0x12d6)\
+N("anchor chips inc.",0x12be)\
+N("ancor communications, inc.",0x1222)\
+N("andor technology ltd",0x149a)\
+N("andrew corporation",0x122f)\
+N("anigma, inc.",0x1051)\
+N("animation technologies inc.",0x5168)\
+N("annabooks",0x114c)\
+N("annapolis micro systems, inc",0x12db)\
+N("annapurna labs ltd.",0x1c36)\
+N("anritsu corp.",0x1852)\
+N("antal electronic",0x153c)\
+N("antex electronics corporation",0x12cb)\
+N("aopen inc.",0xa0a0)\
+N("apacer technology",0x1bcd)\
+N("apache micro peripherals inc",0x141a)\
+N("apex pc solutions inc",0x13d9)\
+N("apex semiconductor inc",0x12e5)\
+N("appian technology",0x1097)\
+N("apple inc.",0x106b)\
+N("applicom international",0x1389)\
+N("applied computing systems inc",0x15db)\
+N("applied integration corporation",0x14de)\
+N("applied intelligent systems, inc.",0x1213)\
+N("applied magic inc",0x136f)\
+N("applied micro circuits corp.",0x10e8)\
+N("apptech inc",0x13c8)\
+N("apricot computers",0x11b1)\
+N("aprius inc.",0x1a5e)\
+N("aptix corporation",0x10e2)\
+N("aquantia corp.",0x1d6a)\
+N("aralion inc",0x1538)\
+N("archtek telecom corp",0x14fe)\
+N("arcobel graphics bv",0x1321)\
+N("arcom control systems ltd",0x13ab)\
+N("arcus technology, inc.",0x121f)\
+N("ardent technologies inc",0x1566)\
+N("areca technology corp.",0x17d3)\
+N("arescom inc",0x1345)\
+N("argosy research inc",0x13e6)\
+N("argosystems inc",0x1375)\
+N("ariel corporation",0x1220)\
+N("arista networks, inc.",0x3475)\
+N("ark logic inc",0xedd8)\
+N("ark research corp.",0x134b)\
+N("arm",0x13b5)\
+N("arn",0x1591)\
+N("arnold & richter cine technik gmbh & co. betriebs kg",0x1e17)\
+N("array corporation",0x1205)\
+N("array microsystems",0x12bc)\
+N("artesyn communication products",0x1223)\
+N("artimi inc",0x18dd)\
+N("artists graphics",0x10eb)\
+N("artop electronic corp",0x1191)\
+N("artx inc",0x1400)\
+N("arvoo engineering bv",0x18c9)\
+N("asahi kasei microsystems co ltd",0x1379)\
+N("asante technologies, inc.",0x128a)\
+N("ascii corporation",0x10ed)\
+N("ascom (finland) oy",0x1fc0)\
+N("ascom ag",0x1a2b)\
+N("ascor inc",0x1403)\
+N("asic communications corp",0x14df)\
+N("asix electronics corporation",0x125b)\
+N("asix electronics corporation (wrong id)",0xa000)\
+N("askey computer corp.",0x144f)\
+N("asmedia technology inc.",0x1b21)\
+N("aspeed technology, inc.",0x1a03)\
+N("aspex semiconductor ltd",0x16b4)\
+N("asr microelectronics",0x1e5d)\
+N("asrock incorporation",0x1849)\
+N("asrock incorporation (wrong id)",0xf849)\
+N("ast research inc",0x100d)\
+N("astrodesign, inc.",0x11bf)\
+N("astronics corporation",0x1bd0)\
+N("astute networks inc.",0x18a1)\
+N("asustek computer inc.",0x1043)\
+N("asustek computer inc. (wrong id)",0xf043)\
+N("asustek computer, inc.",0x807d)\
+N("at&t",0x18a3)\
+N("at&t gis (ncr)",0x101a)\
+N("atalla corp",0x1340)\
+N("atcom technology co., ltd.",0xb1d9)\
+N("atelier informatiques et electronique etudes s.a.",0x1539)\
+N("aten international co. ltd.",0x1735)\
+N("aten research inc",0x106a)\
+N("atl products",0x1370)\
+N("atlantek microsystems pty ltd",0x1589)\
+N("atm communications inc",0x1364)\
+N("atmel corporation",0x1114)\
+N("atmel-dream",0x1438)\
+N("atomic rules llc",0x1d6c)\
+N("atp electronics inc",0x1db2)\
+N("atronics",0x907f)\
+N("attachmate corporation",0x1199)\
+N("atto technology, inc.",0x117c)\
+N("audio digital imaging inc",0x13a5)\
+N("audiocodes inc",0x14f8)\
+N("audioscience inc",0x175c)\
+N("audiotrak",0x3130)\
+N("auravision",0x11d1)\
+N("aureal semiconductor",0x12eb)\
+N("aurora technologies, inc.",0x125c)\
+N("auspex systems inc.",0x10c2)\
+N("autologic inc.",0x10d5)\
+N("automated wagering international",0x1608)\
+N("automation products ab",0x14c5)\
+N("auvitek",0x199f)\
+N("auzentech co., ltd.",0x584d)\
+N("auzentech, inc.",0x415a)\
+N("aval nagasaki corporation",0x1264)\
+N("avance logic inc.",0x4005)\
+N("avance logic inc. [ali]",0x1005)\
+N("avc technology, inc.",0x1289)\
+N("avermedia technologies inc",0x1461)\
+N("avid technology inc.",0x11af)\
+N("avm gmbh",0x1244)\
+N("avsys corporation",0x1157)\
+N("avtec systems",0x156a)\
+N("avvida systems inc.",0x1885)\
+N("award software international inc.",0x10c4)\
+N("aware, inc.",0x147c)\
+N("axera semiconductor co., ltd",0x1f4b)\
+N("axiado corp.",0x1e6b)\
+N("axil computer inc",0x4978)\
+N("aydin corp",0x13fb)\
+N("aztech system ltd",0x11ae)\
+N("azurewave",0x1a3b)\
+N("b&b electronics manufacturing company, inc.",0x1896)\
+N("b&r industrial automation gmbh",0x1677)\
+N("b-tree systems inc",0x15f0)\
+N("bachmann electronic gmbh",0x0bae)\
+N("baidu technology",0x1d22)\
+N("baldor electric company",0x145f)\
+N("baltimore",0x1533)\
+N("banctec",0x15f7)\
+N("banksoft canada ltd",0x1501)\
+N("barco",0x13cc)\
+N("barco graphics nv",0x11a4)\
+N("barefoot networks, inc.",0x1d1c)\
+N("barr systems inc.",0x11b3)\
+N("basler ag",0x1ae8)\
+N("basler gmbh",0x138e)\
+N("bay networks",0x1470)\
+N("bayer corporation, agfa division",0x1203)\
+N("bcm advanced research",0x10d7)\
+N("beckhoff gmbh",0x15ec)\
+N("becton & dickinson",0x117d)\
+N("behavior tech computer corp",0x1510)\
+N("beholder international ltd.",0x5ace)\
+N("beijing bytedance network technology co., ltd.",0x1e93)\
+N("beijing dajia internet information technology co.",0x1024)\
+N("beijing dayu technology",0x1f02)\
+N("beijing guangruntong technology development co.,ltd",0x1e18)\
+N("beijing memblaze technology co. ltd.",0x1c5f)\
+N("beijing panyi technology co., ltd",0x1e57)\
+N("beijing sinead technology co., ltd.",0x1dcf)\
+N("beijing spacecontrol technology co.ltd",0x2048)\
+N("beijing starblaze technology co. ltd.",0x9d32)\
+N("beijing wangxun technology co., ltd.",0x8088)\
+N("belkin",0x1799)\
+N("belkin corporation",0xec80)\
+N("bell corp",0x1521)\
+N("benchmarq microelectronics",0x10a7)\
+N("benq corporation",0x17ff)\
+N("berg electronics",0x1118)\
+N("better on-line solutions",0x1427)\
+N("bfg tech",0x19f1)\
+N("bihl+wiedemann gmbh",0x3442)\
+N("billionton systems inc",0x14cb)\
+N("biopac systems inc",0x1481)\
+N("biostar microtech int'l corp",0x1565)\
+N("biotronic srl",0x12d7)\
+N("bitboys oy",0x15ca)\
+N("bitflow inc",0x118d)\
+N("bitland(shenzhen) information technology co., ltd.",0x1642)\
+N("bitmicro networks inc.",0x192a)\
+N("bitran corporation",0x13bc)\
+N("bittware, inc.",0x12ba)\
+N("biwin storage technology co., ltd.",0x1dee)\
+N("blackmagic design",0xbdbd)\
+N("blaize, inc",0x1e38)\
+N("blue chip technology ltd",0x13c7)\
+N("bluecherry",0x1bb3)\
+N("bluesteel networks inc",0x15ab)\
+N("boca research inc.",0x10c0)\
+N("bops inc",0x1593)\
+N("boulder design labs inc",0x14dd)\
+N("brain boxes",0x135a)\
+N("brainchip inc",0x1e7c)\
+N("brains co. ltd",0x1381)\
+N("braintech inc",0x1211)\
+N("brea technologies inc",0x0a89)\
+N("bridgeport machines",0x1174)\
+N("broadband networks inc",0x13aa)\
+N("broadband technologies",0x132b)\
+N("broadcom",0x1166)\
+N("broadcom / lsi",0x1000)\
+N("broadcom corporation",0x166d)\
+N("broadcom inc",0xfeda)\
+N("broadcom inc. and subsidiaries",0x14e4)\
+N("broadlogic",0x14f3)\
+N("brocade communications systems, inc.",0x13f3)\
+N("brooktree corporation",0x109e)\
+N("brooktrout technology inc",0x12e4)\
+N("bst communication technology ltd",0x14b0)\
+N("bt electronics",0x1338)\
+N("budker institute of nuclear physics",0x4624)\
+N("bug, inc. sapporo japan",0x119d)\
+N("bull hn information systems",0x119f)\
+N("burlywood, inc",0x1e3d)\
+N("bus-tech, inc.",0x1233)\
+N("buslogic",0x104b)\
+N("buslogic inc.",0x4b10)\
+N("bvm ltd",0x15c0)\
+N("c't magazin fuer computertechnik",0x6374)\
+N("c-guys, inc.",0x1947)\
+N("c-media electronics inc",0x13f6)\
+N("c-port corp",0x150e)\
+N("cabletron systems inc",0x10b1)\
+N("cace technologies, inc.",0xcace)\
+N("cache computer",0x1087)\
+N("cacheflow inc",0x15e0)\
+N("cadence design systems, inc.",0x17cd)\
+N("calculex inc",0x13e4)\
+N("caldigit, inc.",0x1ab6)\
+N("calian sed",0x1e94)\
+N("cambrionix ltd.",0xca3b)\
+N("canny edge",0xcaed)\
+N("canon information systems research aust.",0x11ac)\
+N("canon reseach centre france",0x14f0)\
+N("canon research center, america",0x143b)\
+N("canopus co., ltd",0x114b)\
+N("capital equipment corp",0x12fc)\
+N("cardexpert technology",0x10b0)\
+N("cardio control n.v.",0x14bd)\
+N("carry computer eng. co ltd",0x14ef)\
+N("casio computer co., ltd.",0x1265)\
+N("castlenet technology inc.",0x1688)\
+N("catalina research inc",0x144c)\
+N("catalyst enterprises inc",0x15a2)\
+N("catapult communications",0xcccc)\
+N("caustic graphics inc.",0x1aee)\
+N("cavium qlogic",0x1657)\
+N("cavium, inc.",0x177d)\
+N("cci/triad",0x15b4)\
+N("celeno communications",0x1d69)\
+N("celestica",0x18d4)\
+N("celoxica",0x1a5d)\
+N("cemax-icon inc",0x155c)\
+N("cenatek inc",0x16ca)\
+N("centillium technology corp",0x1511)\
+N("central data corporation",0x1248)\
+N("central system research co ltd",0x1604)\
+N("centre for development of advanced computing",0x1169)\
+N("century systems, inc.",0x123c)\
+N("cern/ecp/edu",0x10dc)\
+N("cesnet, z.s.p.o.",0x18ec)\
+N("cetia",0x10d6)\
+N("chaintech computer co. ltd",0x1076)\
+N("chameleon systems inc",0x1506)\
+N("chaplet system inc",0x1520)\
+N("chase research",0x12e0)\
+N("chelsio communications inc",0x1425)\
+N("chengdu beizhongwangxin technology co., ltd.",0xd20c)\
+N("chengdu haiguang ic design co., ltd.",0x1d94)\
+N("chenming mold ind. corp.",0x18ee)\
+N("chicony electronics co ltd",0x1553)\
+N("china mobile (hangzhou) information technology co.ltd.",0x1f2f)\
+N("chip express corporation",0x13e8)\
+N("chips and technologies",0x102c)\
+N("chori joho system co. ltd",0x134c)\
+N("chromatic research inc.",0x110b)\
+N("chryon corp",0x1531)\
+N("chrysalis-its",0xcafe)\
+N("cimetrics inc",0x15b5)\
+N("cincinnati milacron",0x1144)\
+N("cipher systems inc",0x1396)\
+N("ciprico, inc.",0x1aa8)\
+N("cirel systems",0x12e6)\
+N("cirrus logic",0x1013)\
+N("cirtech (uk) ltd",0x14d3)\
+N("cis technology inc",0x1436)\
+N("cisco aironet wireless communications",0x14b9)\
+N("cisco systems inc",0x1137)\
+N("city gate development ltd",0x106f)\
+N("clarion co. ltd",0x1398)\
+N("clearspeed technology plc",0x1942)\
+N("cleveland motion controls",0x1469)\
+N("clevo/kapok computer",0x1558)\
+N("club-3d bv",0x196d)\
+N("club-3d vb (wrong id)",0x169d)\
+N("cnet technologies, inc.",0x5519)\
+N("cnet technology inc",0x1371)\
+N("cnex labs",0x1d1d)\
+N("co-time computer ltd",0x104f)\
+N("cocom a/s",0x13ce)\
+N("cogent data technologies, inc.",0x1109)\
+N("cogetec informatique inc",0x4594)\
+N("cognex",0x12f7)\
+N("cognex corporation",0x12b7)\
+N("cognio inc.",0x1fce)\
+N("collion ug & co.kg",0x1cb1)\
+N("cologne chip designs gmbh",0x1397)\
+N("colorgraphic communications corp",0x130b)\
+N("colorgraphic communications corp.",0x2304)\
+N("combox ltd",0x151b)\
+N("commex technologies",0x1a84)\
+N("commtech, inc.",0x18f7)\
+N("comp. & comm. research lab",0x1035)\
+N("compal electronics inc",0x14c0)\
+N("compaq",0x1032)\
+N("compaq computer corporation",0x021b)\
+N("compaq ipg-austin",0x10da)\
+N("compatible systems corporation",0x13cd)\
+N("compcore multimedia, inc.",0x129d)\
+N("compex",0x11f6)\
+N("compression labs, inc.",0x120d)\
+N("compro computer services, inc.",0x1090)\
+N("compro technology, inc.",0x185b)\
+N("compu-shack",0x11f0)\
+N("compumaster srl",0x15a0)\
+N("computer hi-tech co ltd",0x14d1)\
+N("computer peripherals international",0x13fc)\
+N("computer sciences corp",0x1302)\
+N("computerm corp.",0x12bd)\
+N("computervision",0x1130)\
+N("computex co ltd",0x154b)\
+N("computing devices international",0x11f5)\
+N("computone corporation",0x8e0e)\
+N("computrend",0x1041)\
+N("comstream",0x1277)\
+N("concept development inc",0x1390)\
+N("concurrent real-time",0x1542)\
+N("concurrent technologies, inc.",0x125f)\
+N("condor engineering inc",0x13c6)\
+N("conexant systems, inc.",0x14f1)\
+N("connect components ltd",0x17ee)\
+N("connect tech inc",0x12c4)\
+N("connectix virtual pc",0x2955)\
+N("connectware inc",0x116b)\
+N("contaq microsystems",0x1080)\
+N("contec co., ltd",0x1221)\
+N("contemporary controls",0x1571)\
+N("controlnet inc",0x1383)\
+N("convergenet technologies inc",0x1417)\
+N("convex computer corporation",0x11a0)\
+N("coppercom inc",0x13ef)\
+N("coreco inc",0x11ec)\
+N("corigine, inc.",0x1da8)\
+N("cornelis networks",0x434e)\
+N("cornerstone technology",0x10ae)\
+N("corollary, inc",0x118c)\
+N("corsair",0x1b1c)\
+N("corsair memory, inc",0x1cfa)\
+N("coyote technologies llc",0x14f6)\
+N("cpu technology",0x110e)\
+N("cr-systems a/s",0x1401)\
+N("cray communications a/s",0x11e0)\
+N("cray inc",0x17db)\
+N("creamware gmbh",0x14b5)\
+N("creative electronic systems sa",0x10f6)\
+N("creative labs",0x1102)\
+N("creatix polymedia gmbh",0x16be)\
+N("credence systems corporation",0x1830)\
+N("crest microsystem inc",0x1141)\
+N("crisc corp",0x12e8)\
+N("crosfield electronics limited",0x11dd)\
+N("crosspoint solutions, inc.",0x127c)\
+N("cryptek",0x145c)\
+N("crypto ag",0x1320)\
+N("crystal group inc",0x13a0)\
+N("csp, inc.",0x1c09)\
+N("cspi",0x121e)\
+N("css corporation",0x1200)\
+N("csti",0x134e)\
+N("cti, inc",0x14ae)\
+N("curtiss-wright controls embedded computing",0xccec)\
+N("custom technology corp.",0x1423)\
+N("cyberfirm inc",0x15da)\
+N("cybernetics technology co ltd",0x15d8)\
+N("cyclades corporation",0x120e)\
+N("cyclone microsystems, inc.",0x113c)\
+N("cylink",0x124e)\
+N("cyrix corporation",0x1078)\
+N("cytec corp",0x1582)\
+N("d-link system inc",0x07d1)\
+N("d.c.m. data systems",0x11c7)\
+N("daewoo telecom ltd",0x1070)\
+N("daikin industries, ltd",0x1472)\
+N("dainippon screen mfg. co. ltd",0x11c6)\
+N("daktronics, inc",0x1c33)\
+N("dallas semiconductor",0x13ea)\
+N("dalsa inc.",0x112f)\
+N("dapha electronics corporation",0x10bb)\
+N("daptechnology b.v.",0x194a)\
+N("dapustor corporation",0x1e3b)\
+N("daqdata gmbh",0x19a8)\
+N("data general corporation",0x1089)\
+N("data kinesis inc.",0x1229)\
+N("data patterns",0x179c)\
+N("data race inc",0x14c6)\
+N("data technology corporation",0x107f)\
+N("data translation",0x1116)\
+N("databook inc",0x10b3)\
+N("datacube, inc",0x1117)\
+N("dataexpert corporation",0x10c9)\
+N("datakinetics ltd",0x14ed)\
+N("dataland",0x1e7b)\
+N("datalex communcations",0x1537)\
+N("datapath limited",0xdada)\
+N("dataworld international ltd",0x1185)\
+N("datel inc",0x11fb)\
+N("datum inc. bancomm-timing division",0x12e2)\
+N("davicom semiconductor, inc.",0x1282)\
+N("davicom semiconductor, inc. (wrong id)",0x0291)\
+N("dawicontrol computersysteme gmbh",0x5678)\
+N("dawicontrol gmbh",0xdc93)\
+N("dawning information industry co., ltd.",0x1cb8)\
+N("dawson france",0x12f6)\
+N("dbeeset technology",0x1353)\
+N("dcm data systems",0x1544)\
+N("ddk electronics inc",0x1568)\
+N("ddrdrive llc",0x19e3)\
+N("decision computer international co.",0x6666)\
+N("deepx co., ltd.",0x1ff4)\
+N("dektec digital video b.v.",0x1a0e)\
+N("dell",0x1028)\
+N("dell (wrong id)",0x0128)\
+N("dell emc",0x1120)\
+N("dell inc. (wrong id)",0x0497)\
+N("delphax",0x1243)\
+N("delta electronics inc",0x1599)\
+N("delta electronics, inc",0x1500)\
+N("deltacast",0x1b66)\
+N("deltaww",0x1a05)\
+N("densan company ltd",0x1192)\
+N("dera storage",0x1d78)\
+N("designpro inc.",0x1466)\
+N("deuretzbacher gmbh & co. eng. kg",0x11a3)\
+N("development concepts inc",0x1391)\
+N("devolo ag",0x1815)\
+N("dfi inc",0x15bd)\
+N("dfi, inc",0x106e)\
+N("diablo technologies",0xdb10)\
+N("diagnostic instruments inc",0x15f2)\
+N("dialogic corp",0x12c7)\
+N("dialogic corporation",0x1133)\
+N("dialogue technology corp.",0x18d8)\
+N("diamanti, inc.",0x1d4c)\
+N("diamond multimedia systems",0x1092)\
+N("diatrend corporation",0x1478)\
+N("dibcom",0x1932)\
+N("digalog systems inc",0x158a)\
+N("digi international",0x114f)\
+N("digicom",0x10ab)\
+N("digicom spa",0x1467)\
+N("digicom systems, inc.",0x148d)\
+N("digigram",0x1369)\
+N("digital audio labs inc",0x151c)\
+N("digital devices gmbh",0xdd01)\
+N("digital equipment corp",0x4143)\
+N("digital equipment corporation",0x1011)\
+N("digital first, inc.",0x1705)\
+N("digital processing systems inc.",0x11e8)\
+N("digital receiver technology inc",0xac1e)\
+N("digitan systems inc",0x141d)\
+N("digiteq automotive",0x1ed8)\
+N("digitmedia corp",0x15f3)\
+N("digium, inc.",0xd161)\
+N("dini group",0x17df)\
+N("dipix technologies, inc.",0x1246)\
+N("distant early warning communications inc",0x1982)\
+N("distributed management task force, inc. (dmtf)",0x1ab4)\
+N("ditect coop",0x158f)\
+N("diva systems corp",0x1595)\
+N("diversified technology",0x1068)\
+N("dlog gmbh",0x13b6)\
+N("document technologies, inc",0x11c4)\
+N("dolphin interconnect solutions as",0x11c8)\
+N("dome imaging systems inc",0x11ee)\
+N("dome inc",0x1323)\
+N("dooin electronics",0x1459)\
+N("doug carson & associates",0x1474)\
+N("dpt",0x1d44)\
+N("dreamtech co ltd",0x15cd)\
+N("dresearch digital media systems gmbh",0x15eb)\
+N("drs technologies",0x1a8e)\
+N("drut technologies inc.",0x1e96)\
+N("dsc communications",0x1241)\
+N("dsp research inc",0x140a)\
+N("dtc technology corp.",0x134a)\
+N("dtk computer",0x14c2)\
+N("duagon ag",0x1a88)\
+N("dual technology corp",0x1579)\
+N("duet technologies",0x1306)\
+N("dunord technologies",0x5544)\
+N("dvbsky",0x4254)\
+N("dvico corporation",0x18ac)\
+N("dwave system inc",0x1354)\
+N("dy4 systems inc",0xd4d4)\
+N("dynachip corporation",0x137d)\
+N("dynalink",0x0675)\
+N("dynamic engineering",0xdcba)\
+N("dynamic pictures, inc",0x1139)\
+N("dynamics research corporation",0x13e2)\
+N("dynarc inc",0x1460)\
+N("e-tech inc",0x13df)\
+N("eagle technology",0xea01)\
+N("eastman kodak",0x11b2)\
+N("eaton corporation",0x13c9)\
+N("echelon corp",0x1532)\
+N("echo digital audio corporation",0xecc0)\
+N("echotek corp",0x1517)\
+N("eclipse electronic systems, inc.",0x19ff)\
+N("edec co ltd",0x1428)\
+N("edimax computer co.",0x1432)\
+N("eeetop",0x1bfd)\
+N("efa corporation of america",0x1082)\
+N("efficient networks, inc",0x111a)\
+N("egenera, inc.",0x1890)\
+N("eideticom, inc",0x1de5)\
+N("eizo rugged solutions",0x1227)\
+N("ekf elektronik gmbh",0xe4bf)\
+N("elcus",0xe1c5)\
+N("eldec",0x111e)\
+N("elecom co ltd",0x13b9)\
+N("electronic design gmbh",0x12f8)\
+N("electronic equipment production & distribution gmbh",0x1377)\
+N("electronics & telecommunications rsh",0x1058)\
+N("electronics for imaging",0x116e)\
+N("elektrobit austria gmbh",0x1c7f)\
+N("elitegroup computer systems",0x1019)\
+N("elmic systems inc",0x140c)\
+N("elsa ag",0x1048)\
+N("elsag bailey",0x11ea)\
+N("eltec elektronik gmbh",0x1433)\
+N("embedded intelligence, inc.",0x1cc5)\
+N("emdoor digital technology co., ltd",0x2782)\
+N("emergetech company ltd.",0x1ebd)\
+N("emerson automation solutions",0xea50)\
+N("emtec co., ltd",0x1499)\
+N("emulex corporation",0x10df)\
+N("endace measurement systems, ltd",0xeace)\
+N("endrun technologies",0x7401)\
+N("ene technology inc",0x1524)\
+N("engineering design team, inc.",0x123d)\
+N("enmotus inc",0x1c44)\
+N("ennovate networks inc",0x14b2)\
+N("ennyah technologies corp.",0x1789)\
+N("ensoniq",0x1274)\
+N("ensoniq (old)",0x5145)\
+N("entridia corp",0x15d6)\
+N("enyx",0x1d8f)\
+N("eonic b.v. the netherlands",0x16c9)\
+N("epix inc",0x165a)\
+N("epl limited",0x139d)\
+N("epox computer co., ltd.",0x1695)\
+N("epson",0x1008)\
+N("equator technologies inc",0x12d5)\
+N("equinox systems, inc.",0x113f)\
+N("ericsson axe r & d",0x14d0)\
+N("erma - electronic gmbh",0x1485)\
+N("es computer company, ltd.",0x1262)\
+N("escalate networks inc",0x145a)\
+N("esd electronic system design gmbh",0x12fe)\
+N("espia srl",0x1ab9)\
+N("ess technology",0x125d)\
+N("essence technology, inc.",0xe55e)\
+N("essential communications",0x120f)\
+N("etas gmbh",0x16f2)\
+N("ethernity networks",0x1df3)\
+N("etron technology, inc.",0x1b6f)\
+N("euresys s.a.",0x1805)\
+N("eurocore",0x1125)\
+N("european space agency",0x16e3)\
+N("europop ag",0x1606)\
+N("eurosoft (uk)",0x157c)\
+N("evans & sutherland",0x10dd)\
+N("everex systems inc",0x10a3)\
+N("evergreen technologies inc",0x1535)\
+N("evga.com. corp.",0x3842)\
+N("evsx inc",0x15c4)\
+N("exablaze",0x1ce4)\
+N("exacq technologies",0x5851)\
+N("exar corp.",0x13a8)\
+N("excalibur systems inc",0x1405)\
+N("excel switching corp",0x1419)\
+N("excellent design, inc.",0x1123)\
+N("exegy inc.",0x19c1)\
+N("exsys",0xd84d)\
+N("extreme packet device inc",0x15f6)\
+N("ezchip technologies",0x1719)\
+N("f5 networks, inc.",0xf5f5)\
+N("fabric7 systems, inc.",0xfab7)\
+N("fadu inc.",0x1dc5)\
+N("fairchild semiconductor",0x1574)\
+N("fantasia trading llc",0x1d5c)\
+N("fanuc ltd",0x141e)\
+N("faraday technology corp",0x159b)\
+N("farsite communications ltd",0x1619)\
+N("fast corporation",0x1463)\
+N("fast multimedia ag",0x10fe)\
+N("faster technology, llc.",0x1958)\
+N("fastpoint technologies inc",0x15ff)\
+N("featron technologies corporation",0x14a8)\
+N("fedetec inc.",0xfede)\
+N("fic (first international computer inc)",0x15d2)\
+N("filanet corp",0x153d)\
+N("finisar corp.",0x131a)\
+N("firmworks",0x1129)\
+N("first international computer inc",0x1509)\
+N("first international computers [fic]",0x1094)\
+N("first virtual corporation",0x1219)\
+N("first wise media gmbh",0x1ae7)\
+N("fishcamp engineering",0x1230)\
+N("flex-logix technologies",0x22b8)\
+N("flexxon pte ltd",0x1efb)\
+N("flytech technology co ltd",0x152b)\
+N("fn-link technology limited",0x0018)\
+N("focusrite audio engineering ltd",0x1cb5)\
+N("folsom research inc",0x1596)\
+N("force computers",0x1146)\
+N("force10 networks, inc.",0x1a17)\
+N("ford microelectronics inc",0x13f2)\
+N("fore systems inc",0x1127)\
+N("forex computer corporation",0x1083)\
+N("forks",0x12f5)\
+N("forks inc",0x1184)\
+N("formation inc.",0x11eb)\
+N("formosa industrial computing",0x147a)\
+N("fortemedia, inc",0x1319)\
+N("fortinet, inc.",0x1a29)\
+N("forvus research inc",0x150a)\
+N("fountain technologies, inc.",0x1049)\
+N("four fold ltd",0x12f9)\
+N("foxconn international, inc.",0x105b)\
+N("foxconn international, inc. (wrong id)",0xf05b)\
+N("framatome connectors usa inc.",0x1034)\
+N("framework computer inc.",0xf111)\
+N("freescale semiconductor inc",0x1957)\
+N("fresco logic",0x1b73)\
+N("fujifacom corporation",0x1362)\
+N("fujifilm",0x127f)\
+N("fujifilm business innovation corp.",0x1135)\
+N("fujifilm microdevices",0x12bf)\
+N("fujikura ltd",0x1183)\
+N("fujitsu client computing limited",0x1e26)\
+N("fujitsu computer products of america",0x151d)\
+N("fujitsu limited.",0x10cf)\
+N("fujitsu microelectr., inc.",0x10ca)\
+N("fujitsu microelectronics ltd.",0x119e)\
+N("fujitsu technology solutions",0x1734)\
+N("fundamental software inc",0x1404)\
+N("fungible",0x1dad)\
+N("furiosaai, inc.",0x1ed2)\
+N("fusion micromedia corp",0x138a)\
+N("future domain corp.",0x1036)\
+N("future techno designs pte ltd",0x138d)\
+N("futureplus systems corp.",0x10d1)\
+N("futuretel inc",0x12b4)\
+N("fwb inc",0x113a)\
+N("g force co, ltd",0x12c8)\
+N("g2 networks, inc.",0x128d)\
+N("gage applied sciences, inc.",0x1197)\
+N("gainbery computer products inc.",0x10e6)\
+N("galax",0x1b4c)\
+N("galea network security",0x159f)\
+N("gallant computer inc",0x145d)\
+N("gammagraphx, inc.",0x12f2)\
+N("gammalink",0x12b1)\
+N("garnets system co ltd",0x14e9)\
+N("gateway, inc.",0x107b)\
+N("gde systems, inc.",0x12d0)\
+N("ge spacenet",0x12e9)\
+N("gec plessey semi inc.",0x11e1)\
+N("gecube technologies, inc.",0x18bc)\
+N("gemflex networks",0x157d)\
+N("gemlight computer ltd.",0x109b)\
+N("gemtek technology co., ltd",0x17f9)\
+N("gemtek technology corporation",0x5046)\
+N("general dynamics",0x0123)\
+N("general electric",0x1775)\
+N("general instrument",0x159a)\
+N("general signal networks",0x12b2)\
+N("genesys logic, inc",0x17a0)\
+N("genoa systems corp",0x1047)\
+N("genrad inc",0x15ce)\
+N("genroco, inc",0x5555)\
+N("geocast network systems",0x15a1)\
+N("gespac",0x1310)\
+N("gesytec gmbh",0x1555)\
+N("get engineering corp",0x15e7)\
+N("gfai e.v.",0x1a1d)\
+N("gidel ltd.",0x165c)\
+N("gigabyte technology co., ltd",0x1458)\
+N("gigalabs inc",0x136d)\
+N("giganet inc",0x135b)\
+N("gigapixel corp",0x919a)\
+N("gigi operations",0x12c9)\
+N("gilat satellite networks",0x1431)\
+N("gilbarco, inc.",0x1258)\
+N("git co ltd",0x1072)\
+N("glenfly tech co., ltd.",0x6766)\
+N("global sun technology inc",0x16ab)\
+N("global unichip corp.",0x1ac1)\
+N("global velocity, inc.",0x1aae)\
+N("globe manufacturing sales",0x10a4)\
+N("globespan semiconductor inc.",0x14bc)\
+N("globetek",0x151a)\
+N("gmm research corp",0x12c1)\
+N("gn nettest telecom div.",0x1465)\
+N("goepel electronic gmbh",0x140e)\
+N("google, inc.",0x1ae0)\
+N("gotview",0x5456)\
+N("gpt limited",0x1232)\
+N("grai matter labs",0x1ef6)\
+N("granite microsystems",0x1598)\
+N("granite systems inc.",0x12b5)\
+N("graphcore ltd",0x1d95)\
+N("graphics microsystems inc",0x13d4)\
+N("graphin co ltd",0x1446)\
+N("green logic",0x118f)\
+N("greenliant",0x1bf5)\
+N("groq",0x1de0)\
+N("growth networks",0x4943)\
+N("gsi technology",0x1e4c)\
+N("guillemot corporation",0x14af)\
+N("guizhou huaxintong semiconductor technology co., ltd",0x1dbf)\
+N("guzik technical enterprises",0x1253)\
+N("gvc corporation",0x13e0)\
+N("gw instruments",0x1271)\
+N("habana labs ltd.",0x1da3)\
+N("hailo technologies ltd.",0x1e60)\
+N("hal computer systems, inc.",0x11cd)\
+N("hamamatsu photonics k.k.",0x11a1)\
+N("hangzhou silan microelectronics co., ltd.",0x1904)\
+N("hansol electronics inc.",0x3000)\
+N("harlequin ltd",0x115a)\
+N("harman international industries inc",0x1300)\
+N("hasotec gmbh",0x0e55)\
+N("hauppauge computer works inc",0x13eb)\
+N("hauppauge computer works inc.",0x0070)\
+N("hauppauge computer works inc. (wrong id)",0x0270)\
+N("hawking technologies",0x17b3)\
+N("hayes microcomputer products inc",0x13ee)\
+N("hectronic ab",0x1a51)\
+N("hefei datang storage technology co.,ltd.",0x1eab)\
+N("heidelberger druckmaschinen ag",0x112b)\
+N("heitec ag",0x1e85)\
+N("hercules",0x1681)\
+N("hercules computer technology inc",0x4843)\
+N("hermes electronics company, ltd.",0x112a)\
+N("hermstedt gmbh",0x118e)\
+N("herrick technology laboratories, inc. [htl]",0x78c0)\
+N("hewlett packard",0x11c0)\
+N("hewlett packard enterprise",0x1590)\
+N("hewlett packard gmbh pl24-mkt",0xa25b)\
+N("hewlett-packard company",0x103c)\
+N("hewlett-packard company (wrong id)",0x0303)\
+N("hexaflake (shanghai) information technology co., ltd.",0x1faa)\
+N("hgst, inc.",0x1c58)\
+N("hifn inc.",0x13a3)\
+N("high soft tech",0x136a)\
+N("high street consultants",0x11fd)\
+N("high tech computer corp (htc)",0x15bf)\
+N("highland technology, inc.",0x1c32)\
+N("highly reliable systems",0x1a57)\
+N("highpoint technologies, inc.",0x1103)\
+N("hightech information system ltd.",0x1787)\
+N("highwater designs ltd.",0x11e9)\
+N("hilevel technology",0x118a)\
+N("hilscher gesellschaft für systemautomation mbh",0x15cf)\
+N("hint corp",0x3388)\
+N("hippstor technology",0x1fe4)\
+N("hirakawa hewtech corp",0x14d7)\
+N("hitachi computer products",0x1020)\
+N("hitachi information technology co ltd",0x1388)\
+N("hitachi micro systems",0x1037)\
+N("hitachi microcomputer system ltd",0x1250)\
+N("hitachi semiconductor & devices sales co ltd",0x158c)\
+N("hitachi zosen corporation",0x1367)\
+N("hitachi, ltd",0x1054)\
+N("hitt",0x1578)\
+N("hivertec inc",0x14a9)\
+N("holco enterprise co, ltd/shuttle computer",0x1297)\
+N("holontech corp",0x133c)\
+N("holtek",0x9412)\
+N("holtek microelectronics inc",0x12c3)\
+N("honda connectors/mhotronics inc",0x1508)\
+N("honeywell iac",0x10ac)\
+N("hongqin (beijing) technology co., ltd.",0x7526)\
+N("hoontech corporation/samho multi tech ltd.",0x128e)\
+N("hopf elektronik gmbh",0x14d8)\
+N("hotrail inc",0x15cc)\
+N("hsing tech. enterprise co., ltd.",0x165d)\
+N("ht omega inc.",0x7284)\
+N("hualon microelectronics",0x10d4)\
+N("huaqin technology co.ltd",0x1e83)\
+N("huawei technologies co., ltd.",0x19e5)\
+N("hughes network systems",0x1273)\
+N("humusoft, s.r.o.",0x186c)\
+N("hunan goke microelectronics co., ltd",0x21b4)\
+N("hybricon corp.",0x1218)\
+N("hynix semiconductor",0x106c)\
+N("hypercope gmbh",0x1365)\
+N("hyperparallel technologies",0x1210)\
+N("hypertec pty limited",0x118b)\
+N("hytec electronics ltd",0x1196)\
+N("i+me actia gmbh",0xd531)\
+N("i-bus",0x1079)\
+N("i-cube inc",0x11f9)\
+N("i-data international a-s",0x135f)\
+N("i-o data device, inc.",0x10fc)\
+N("i-tek optoelectronics co., ltd.",0xca01)\
+N("i.i.t.",0x1061)\
+N("i2s",0x12fd)\
+N("ibm",0x1014)\
+N("ic corporation",0x114d)\
+N("ice lake-lp pci express root port #3",0x34ba)\
+N("icl",0x1056)\
+N("icl personal systems",0x1016)\
+N("icm co., ltd.",0x10c1)\
+N("icp vortex computersysteme gmbh",0x1119)\
+N("icube corporation limited",0x1fb0)\
+N("id quantique",0x179a)\
+N("id quantique sa",0x1e89)\
+N("iei integration corp",0x180c)\
+N("iix consulting",0x11e5)\
+N("ikon corporation",0x11d5)\
+N("ikos systems inc",0x1411)\
+N("ilc data device corp",0x4ddc)\
+N("illegal vendor id",0xffff)\
+N("image access",0x129b)\
+N("image technologies development",0x11d8)\
+N("imagenation corporation",0x1295)\
+N("imagine communications corp.",0x1d65)\
+N("imagraph corporation",0x1165)\
+N("imation corp - medical imaging systems",0x12e3)\
+N("impacct technology corp",0x15ba)\
+N("impact technologies",0x1525)\
+N("in win development inc",0x15ee)\
+N("indigita corporation",0xdead)\
+N("indra networks, inc.",0x17b4)\
+N("inet technologies inc",0x1583)\
+N("infimed",0x12c0)\
+N("infineon technologies ag",0x15d1)\
+N("infinicon systems inc.",0x1820)\
+N("infinilink corp",0x15df)\
+N("infolibria",0x14e2)\
+N("infomedia microelectronics inc.",0x112e)\
+N("information technology inst.",0x119c)\
+N("informtech industrial ltd.",0x10a6)\
+N("infortrend technology, inc.",0x124f)\
+N("infotronic america inc",0x105f)\
+N("initio corporation",0x1101)\
+N("innodisk corporation",0x1bc0)\
+N("innogrit corporation",0x1dbe)\
+N("innomedia inc",0x155a)\
+N("innomedialogic inc.",0x148b)\
+N("innominate security technologies ag",0x1993)\
+N("innosilicon co ltd",0x1ec8)\
+N("innosys inc.",0x11a9)\
+N("innotek systemberatung gmbh",0x80ee)\
+N("innovative integration",0x1303)\
+N("innovision multimedia ltd.",0x1771)\
+N("inova computers gmbh & co kg",0x14a6)\
+N("inprocomm inc.",0x17fe)\
+N("inspur electronic information industry co., ltd.",0x1bd4)\
+N("intec gmbh",0x150f)\
+N("integraphics",0x10ea)\
+N("integrated circuit systems",0x117f)\
+N("integrated computing engines",0x12ca)\
+N("integrated micro solutions inc.",0x10e0)\
+N("integrated silicon solution, inc.",0x132d)\
+N("integrated technology express, inc.",0x1283)\
+N("integrated telecom",0x122a)\
+N("integrated telecom express inc",0x1471)\
+N("intel corporation",0x8086)\
+N("intelligent paradigm inc",0x15ef)\
+N("intelligent resources integrated systems",0x116c)\
+N("intelliprop, inc",0x1ea7)\
+N("intellon corp.",0x16e5)\
+N("inter-face co ltd",0x12b3)\
+N("interactive circuits & systems ltd",0x1464)\
+N("interactive images",0x1224)\
+N("interagon as",0xfa57)\
+N("intercom inc.",0x11d2)\
+N("interconnect systems solutions",0x1549)\
+N("interface corp",0x1147)\
+N("intergraph corporation",0x1091)\
+N("international microcircuits inc",0x11be)\
+N("internet machines corporation (imc)",0x1702)\
+N("internext compression inc",0x4444)\
+N("internix inc.",0x14ba)\
+N("interphase corporation",0x107e)\
+N("intersil corporation",0x1260)\
+N("intersil techwell",0x1797)\
+N("intervoice inc",0x1140)\
+N("interware co., ltd",0x1215)\
+N("interworks computer products",0x147d)\
+N("intraserver technology inc",0x13e9)\
+N("intresource systems pte ltd",0x13da)\
+N("inventec corporation",0x1170)\
+N("invertex",0x14e1)\
+N("iogear, inc.",0x17fc)\
+N("ioi technology corp",0x1546)\
+N("iomega corporation",0x13ca)\
+N("ioxos technologies sa",0x7357)\
+N("ip3 tech (hk) limited",0x1e50)\
+N("ipc corporation, ltd.",0x1046)\
+N("iss, inc",0x1526)\
+N("isytec - integrierte systemtechnik gmbh",0x1482)\
+N("ita ingenieurburo fur testaufgaben gmbh",0x1505)\
+N("italtel",0x15a3)\
+N("itd firm ltd.",0x37d9)\
+N("itt aerospace/communications division",0x1430)\
+N("ituner",0xaa00)\
+N("iwasaki information systems co ltd",0x14c4)\
+N("iwatsu electric co ltd",0x137c)\
+N("iwill corp",0x15d4)\
+N("ixxat automation gmbh",0x1bee)\
+N("j & w electronics co., ltd.",0x1afa)\
+N("j. bond computer systems",0x1086)\
+N("j.p. axzam corp",0x15fa)\
+N("jabil circuit inc",0x10d3)\
+N("jae electronics inc.",0x1151)\
+N("janich & klass computertechnik gmbh",0x13db)\
+N("janz computer ag",0x13c3)\
+N("japan computer industry inc",0x14fd)\
+N("japan elecronics ind inc",0x157a)\
+N("japan satellite systems inc",0x137f)\
+N("jato technologies inc.",0x1308)\
+N("jaton corp",0x1b13)\
+N("jaycor",0x129c)\
+N("jazz multimedia",0x1100)\
+N("jet propulsion laboratory",0x1548)\
+N("jetway information co., ltd.",0x16f3)\
+N("jiangsu huacun elec. tech. co., ltd.",0x1e7f)\
+N("jiangsu xinsheng intelligent technology co., ltd",0x1e68)\
+N("jingjia microelectronics co ltd",0x0731)\
+N("jmicron technology corp.",0x197b)\
+N("jni corporation",0x1242)\
+N("jones futurex inc",0x143e)\
+N("jorge scientific corp",0x12b0)\
+N("joytech computer co., ltd.",0x1496)\
+N("jsc nt-com",0x1dfc)\
+N("juko electronics ind. co. ltd",0x10a1)\
+N("jungsoft",0x1567)\
+N("juniper networks",0x1304)\
+N("jusontech corporation",0x9618)\
+N("k&f computing research co.",0x1b1a)\
+N("k.i. technology co ltd",0x13d6)\
+N("kaiser electronics",0x1504)\
+N("kalray inc.",0x1d26)\
+N("kansai electric co. ltd",0x13f5)\
+N("kasan electronics company, ltd.",0x11fa)\
+N("kasten chase applied research",0x19ac)\
+N("kawasaki heavy industries ltd",0x13a1)\
+N("kawasaki lsi usa inc",0x1503)\
+N("kawasaki steel corporation",0x136b)\
+N("keba ag",0xceba)\
+N("keithley metrabyte",0x11f3)\
+N("kinetic systems corporation",0x11f4)\
+N("kingmax technology inc",0x142a)\
+N("kingston technology company, inc.",0x2646)\
+N("kinpo electronics inc",0x15fe)\
+N("kioxia corporation",0x1e0f)\
+N("knc one",0x1894)\
+N("knowledge technology lab.",0x1299)\
+N("kofax image products",0x1296)\
+N("koga electronics co",0x15f8)\
+N("kolter electronic",0x1001)\
+N("kongsberg spacetec as",0x1629)\
+N("konica corp",0x1587)\
+N("kontron",0x1059)\
+N("korg",0x12b8)\
+N("kratos analytical ltd",0x1355)\
+N("kratos defense & security solutions, inc.",0x1fde)\
+N("kti",0x8e2e)\
+N("kvaser ab",0x1a07)\
+N("kworld computer co. ltd.",0x17de)\
+N("kye systems corporation",0x1489)\
+N("kyopal co ltd",0x150c)\
+N("kyoto microcomputer co",0x1341)\
+N("kyushu electronics systems inc",0x1418)\
+N("l g electronics, inc.",0x117b)\
+N("l-3 communications",0x1876)\
+N("l3 communications",0x14be)\
+N("l3 communications telemetry & instrumentation",0x1486)\
+N("labway corporation",0x1483)\
+N("lambda systems inc",0x1198)\
+N("lanart corporation",0x13b3)\
+N("lancast inc",0x1586)\
+N("land win electronic corp",0x1153)\
+N("lantiq",0x1a30)\
+N("lara technology inc",0x158e)\
+N("lattice - vantis",0x1573)\
+N("lattice semiconductor corporation",0x1204)\
+N("lava computer mfg inc",0x1407)\
+N("lava semiconductor manufacturing inc",0x1607)\
+N("leading edge products inc",0x113d)\
+N("leadtek research inc.",0x107d)\
+N("lectron co ltd",0x149f)\
+N("leitch technology international",0x11b4)\
+N("lenovo",0x17aa)\
+N("leutron vision ag",0x1124)\
+N("level one communications",0x1394)\
+N("levelone",0x018a)\
+N("lewiz communications",0x18df)\
+N("lexicon",0x12ff)\
+N("lexmark international, inc.",0x126a)\
+N("lg electronics [lucky goldstar co. ltd]",0x107c)\
+N("lg electronics, inc.",0x1854)\
+N("lg industrial systems co., ltd",0x122b)\
+N("lightelligence",0x060e)\
+N("lightfleet corporation",0x1a77)\
+N("lightmatter",0x1eca)\
+N("lightwell co ltd - zax division",0x143f)\
+N("linear systems ltd.",0x1254)\
+N("linksys",0x1737)\
+N("linux media labs, llc",0x165f)\
+N("lippert adlink technology gmbh",0x121d)\
+N("liqid inc.",0x1dcd)\
+N("liquid-markets gmbh",0x4c4d)\
+N("lite-on communications inc",0x11ad)\
+N("lite-on it corp. / plextor",0x1c28)\
+N("lite-on technology corporation",0x14a4)\
+N("litronic inc",0x15dc)\
+N("lmc",0x1376)\
+N("lockheed martin federal systems-manassas",0x11d0)\
+N("lockheed martin-marietta corp",0x003d)\
+N("logic corporation",0x1484)\
+N("logic devices inc",0x13b7)\
+N("logic plus plus inc",0x1455)\
+N("logical do ltd",0x1445)\
+N("logitec corp.",0x6409)\
+N("logitron",0x1585)\
+N("loongson technology llc",0x0014)\
+N("loughborough sound images plc",0x1171)\
+N("lp elektronik gmbh",0x155e)\
+N("lr-link",0x4c52)\
+N("lsi corporation",0x11c1)\
+N("lsi logic",0x102a)\
+N("lsi logic corp of canada",0x1015)\
+N("lsi systems, inc",0x11ca)\
+N("lucent technologies",0x12a3)\
+N("lumanate, inc.",0x1809)\
+N("luminex software, inc.",0x116a)\
+N("lung hwa electronics",0x4c48)\
+N("lynx studio technology, inc.",0x1621)\
+N("lynxi technologies co., ltd.",0x1e9f)\
+N("m-pact, inc.",0x1287)\
+N("m-systems flash disk pioneers ltd",0x156f)\
+N("mac system co ltd",0x155d)\
+N("machone communications",0x1541)\
+N("macraigor systems llc",0x152c)\
+N("macrolink inc",0x15ed)\
+N("macronix, inc. [mxic]",0x10d9)\
+N("madge networks",0x10b6)\
+N("maestro digital communications",0x15b9)\
+N("magma",0x11c9)\
+N("magnum semiconductor, inc,",0x1b03)\
+N("mai logic incorporated",0x10cc)\
+N("mainpine ltd",0x1522)\
+N("maker communications",0x1493)\
+N("malleable technologies inc",0x15de)\
+N("management graphics",0x12dd)\
+N("mangoboost inc.",0x1f52)\
+N("mangstor",0x1cfd)\
+N("mapletree networks inc.",0x149e)\
+N("marathon technologies corp.",0x1240)\
+N("marian - electronic & software",0x1382)\
+N("mark of the unicorn inc",0x137a)\
+N("marquette medical systems",0x1487)\
+N("martin-marietta",0x116d)\
+N("marvell technology group ltd.",0x11ab)\
+N("marvin test solutions",0x16e2)\
+N("maspar computer corp",0x1062)\
+N("maspro kenkoh corp",0x14ee)\
+N("matrix corp",0x151e)\
+N("matrix vision gmbh",0x4d56)\
+N("matrox electronics systems ltd.",0x102b)\
+N("matsushita electric industrial co., ltd.",0x10f7)\
+N("matsushita electric works ltd",0x140d)\
+N("matsushita electronics co ltd",0x1189)\
+N("matsushita graphic communication systems, inc.",0x147e)\
+N("matsushita-kotobuki electronics industries, ltd.",0x1261)\
+N("maverick networks",0x14a3)\
+N("max technologies inc",0x154a)\
+N("maxeler technologies ltd.",0x1bbf)\
+N("maxim integrated products",0x101d)\
+N("maxio technology (hangzhou) ltd.",0x1e4b)\
+N("maxlinear",0x17e6)\
+N("maxlinear inc",0x1e43)\
+N("maxspeed corp",0x13b0)\
+N("maxtor corporation",0x115f)\
+N("mazet gmbh",0x1286)\
+N("measurement computing",0x1307)\
+N("measurex corporation",0x12ac)\
+N("media 100 inc",0x13d5)\
+N("media reality technology",0x1293)\
+N("media vision",0x10c7)\
+N("media4",0x139e)\
+N("medialight inc",0x1392)\
+N("mediamatics",0x11ed)\
+N("mediaq inc.",0x4d51)\
+N("mediasonic multimedia systems ltd",0x139b)\
+N("mediastar co ltd",0x1557)\
+N("mediatek corp.",0x14c3)\
+N("medion ag",0x1e39)\
+N("megachips corporation",0x109c)\
+N("megasoft inc",0x1160)\
+N("megatek",0x1152)\
+N("megatel",0x12f4)\
+N("meidensha corporation",0x10a0)\
+N("meilhaus electronic gmbh",0x1402)\
+N("meinberg funkuhren",0x1360)\
+N("melco inc",0x1154)\
+N("melec inc",0x152e)\
+N("mellanox technologies",0x15b3)\
+N("memec design services",0x1597)\
+N("mentec limited",0x12c2)\
+N("mercury computer systems",0x1134)\
+N("meta platforms, inc.",0x1d9b)\
+N("michels & kleberhoff computer gmbh",0x11cc)\
+N("micrel inc",0x132c)\
+N("micrel-kendin",0x16c6)\
+N("micro computer systems inc",0x10af)\
+N("micro industries corporation",0x10e5)\
+N("micro memory",0x1332)\
+N("micro science inc",0x13fd)\
+N("micro-star international co., ltd. [msi]",0x1462)\
+N("microchip technology / smsc",0x1055)\
+N("microcom inc.",0x132a)\
+N("microcomputer systems (m) son",0x1088)\
+N("microdyne corporation",0x1266)\
+N("microgate corporation",0x13c0)\
+N("micron",0x1042)\
+N("micron technology inc",0x1344)\
+N("micron/crucial technology",0xc0a9)\
+N("micronas semiconductor holding ag",0x18c3)\
+N("micronas usa, inc.",0x1905)\
+N("micronics computers inc",0x1012)\
+N("microsemi / pmc / idt",0x111d)\
+N("microsoft corporation",0x1414)\
+N("microtechnica co ltd",0x4d54)\
+N("microtune, inc.",0x1851)\
+N("microunity systems eng. inc",0x11a5)\
+N("midac corporation",0x7bde)\
+N("midas lab inc",0x1410)\
+N("middle digital inc.",0xdeaf)\
+N("mikrom gmbh",0x183b)\
+N("millennium engineering inc",0x14a2)\
+N("mind share, inc.",0x119a)\
+N("mini-max technology, inc.",0x110c)\
+N("minton optic industry co ltd",0x142c)\
+N("mips technologies, inc.",0x153f)\
+N("miro computer products ag",0x1031)\
+N("miroku jyoho service co. ltd",0x13be)\
+N("missing link electronics, inc.",0x22db)\
+N("mitac",0x1071)\
+N("mitani corporation",0x12c6)\
+N("mitel corp.",0x1132)\
+N("mitron computer inc.",0x1175)\
+N("mitsubishi electric",0x1067)\
+N("mitsubishi electric corp.",0x10ba)\
+N("mitsubishi electric logistics support co ltd",0x1502)\
+N("mitsubishi electric microcomputer",0x130a)\
+N("mitsui-zosen system research",0x11e6)\
+N("mitutoyo corp",0x1547)\
+N("mknet corp.",0x1641)\
+N("mmc networks",0x1330)\
+N("mobility electronics",0x14f2)\
+N("mobiveil, inc.",0x1c8c)\
+N("modular technology holdings ltd",0x14c7)\
+N("molex incorporated",0x10d2)\
+N("momentum data systems",0x1136)\
+N("montage technology co., ltd.",0x1b00)\
+N("montilio inc.",0x1989)\
+N("moore threads technology co.,ltd",0x1ed5)\
+N("moreton bay",0x15aa)\
+N("mortara instrument inc",0x1476)\
+N("mosaid technologies inc",0x15b2)\
+N("moschip semiconductor technology ltd.",0x9710)\
+N("most inc",0x10bf)\
+N("motion engineering, inc.",0xc0fe)\
+N("motion media technology ltd",0x13ac)\
+N("motorcomm microelectronics.",0x1f0a)\
+N("motorola",0x1057)\
+N("motorola ?? / htec",0x1507)\
+N("motorola expedience",0x19d1)\
+N("moxa technologies co ltd",0x1393)\
+N("mpl ag",0x18e6)\
+N("msc technologies gmbh",0x1b08)\
+N("mtt co., ltd",0x1322)\
+N("mucse",0x8848)\
+N("multi dimensional consulting inc",0x146f)\
+N("multi-tech systems, inc.",0x1122)\
+N("multidata gmbh",0x12ad)\
+N("multimedia bundle inc",0x13dd)\
+N("multiwave innovation pte ltd",0x1416)\
+N("music semiconductors",0x1523)\
+N("mutech corporation",0x1159)\
+N("mutoh industries inc",0x1167)\
+N("mycom inc",0x1453)\
+N("mylex corporation",0x1069)\
+N("myricom inc.",0x14c1)\
+N("myrtle.ai",0x1ed9)\
+N("myson technology inc",0x1516)\
+N("mythos systems inc",0x14a7)\
+N("n-cubed.net",0x15fd)\
+N("nac incorporated",0x13e7)\
+N("nakayo telecommunications inc",0x14cc)\
+N("nallatech ltd.",0x198a)\
+N("nanjing magewell electronics co., ltd.",0x1cd7)\
+N("nanjing qinheng microelectronics co., ltd.",0x1c00)\
+N("napatech a/s",0x18f4)\
+N("national aerospace laboratories",0x14da)\
+N("national datacomm corp",0x15e8)\
+N("national instruments",0x1093)\
+N("national semiconductor corporation",0x100b)\
+N("natural microsystems",0x12b6)\
+N("ncipher security",0x0100)\
+N("ncomputing x300 pci-engine",0xaa55)\
+N("ncs computer italia",0x1291)\
+N("ncube",0x10ff)\
+N("nds technologies israel ltd",0x15d3)\
+N("nebbiolo technologies",0x1d62)\
+N("nebula electronics ltd.",0x0071)\
+N("nebulamatrix technology",0x1f0f)\
+N("nec corporation",0x1033)\
+N("neomagic corporation",0x10c8)\
+N("nest inc",0x13e3)\
+N("net (network equipment technologies)",0x19e7)\
+N("net insight",0x1477)\
+N("netac technology co.,ltd",0x1f40)\
+N("netaccess",0x11ce)\
+N("netboost corporation",0x13dc)\
+N("netcell corporation",0x169c)\
+N("netchip technology, inc",0x17cc)\
+N("netcope technologies, a.s.",0x1b26)\
+N("neteffect",0x1678)\
+N("netezza corp.",0x1af5)\
+N("netframe systems inc",0x1007)\
+N("netgame ltd",0x1594)\
+N("netgear",0x1385)\
+N("netint technologies inc.",0x1d82)\
+N("netoctave",0x170b)\
+N("netphone, inc",0x1305)\
+N("netpower",0x5700)\
+N("netpower, inc",0x1143)\
+N("netronome systems, inc.",0x19ee)\
+N("netspeed inc.",0x12ce)\
+N("netup inc.",0x1b55)\
+N("netvin",0x4a14)\
+N("network appliance corporation",0x1275)\
+N("network computing devices",0x113b)\
+N("network general corp.",0x1202)\
+N("network peripherals inc",0x11bc)\
+N("networth",0x107a)\
+N("networth technologies inc",0x15e3)\
+N("netxen incorporated",0x4040)\
+N("new h3c technologies co., ltd.",0x193d)\
+N("new wave pdg",0x11df)\
+N("newer technology inc",0x15c2)\
+N("newgen systems corporation",0x12a2)\
+N("newisys, inc.",0x17c2)\
+N("news datacom",0x12a8)\
+N("newtek inc",0x149d)\
+N("nexgen microsystems",0x1074)\
+N("nextcom k.k.",0x14b1)\
+N("nextio",0x18f6)\
+N("nextorage",0x1f31)\
+N("nextsilicon ltd",0xcdfa)\
+N("nexus inc",0x13ad)\
+N("ngd systems, inc.",0x1dbb)\
+N("nicolet technologies b.v.",0x11ef)\
+N("nihon unisys, ltd.",0x147f)\
+N("nikon systems inc",0x114e)\
+N("ningbo harrison electronics co ltd",0x159d)\
+N("nintendo co, ltd",0x12e1)\
+N("nippon electro-sensory devices corp",0x131c)\
+N("nippon texaco., ltd",0x121c)\
+N("nippon unisoft corporation",0x12bb)\
+N("nissin inc co",0x1437)\
+N("nitsuko corporation",0x14d5)\
+N("nkk corporation",0x10f5)\
+N("nokia telecommunications oy",0x13b8)\
+N("nokia wireless communications",0x1603)\
+N("norsk elektro optikk a/s",0x1228)\
+N("north atlantic instruments",0x15ac)\
+N("northern telecom",0x126c)\
+N("northrop grumman - canada ltd",0x1600)\
+N("novasparks",0x1d37)\
+N("novaweb technologies inc",0x14ac)\
+N("novell",0x11da)\
+N("ntt advanced technology corp.",0x13f9)\
+N("ntt innovative devices corporation",0x12a4)\
+N("nuera communications inc",0x1457)\
+N("numascale as",0x1b47)\
+N("number 9 computer company",0x105d)\
+N("nutanix, inc.",0x4e58)\
+N("nvidia / sgs thomson (joint venture)",0x12d2)\
+N("nvidia corporation",0x10de)\
+N("o.n. electronic co ltd.",0x7604)\
+N("o2 micro, inc.",0x1217)\
+N("oa laboratory co ltd",0x1162)\
+N("oak technology, inc",0x104e)\
+N("oakleigh systems inc.",0x108c)\
+N("oce' - technologies b.v.",0x13f1)\
+N("oce' printing systems gmbh",0x1406)\
+N("ocean office automation",0x1063)\
+N("octasic inc.",0x16c8)\
+N("octave communications ind.",0x1450)\
+N("ocz technology group, inc.",0x1b85)\
+N("odetics",0x1347)\
+N("odin telesystems inc",0x14c9)\
+N("oec medical systems, inc.",0x129f)\
+N("oki electric industry co. ltd.",0x1021)\
+N("olicom",0x108d)\
+N("olitec",0x144e)\
+N("olivetti advanced technology",0x102e)\
+N("olympus optical co., ltd.",0x1270)\
+N("omega micro inc.",0x119b)\
+N("omni media technology inc",0x9699)\
+N("omron corporation",0x10cb)\
+N("on semiconductor",0x1529)\
+N("ona electroerosion",0x4150)\
+N("one stop systems, inc.",0x1954)\
+N("onnto corp.",0x167e)\
+N("ono sokki",0x153a)\
+N("opal-rt technologies inc.",0x1b2c)\
+N("open network co ltd",0x1550)\
+N("opencpi.org",0x1df7)\
+N("openvox communication co. ltd.",0x1b74)\
+N("opti inc.",0x1045)\
+N("optibase ltd",0x1255)\
+N("option n.v.",0x1931)\
+N("optivision inc.",0x12ed)\
+N("opto",0x148a)\
+N("oracle/sun",0x108e)\
+N("orad hi-tec systems",0x1966)\
+N("orange micro",0x12ee)\
+N("osi plus corporation",0x148e)\
+N("osicom technologies inc",0x1112)\
+N("ositech communications inc",0x13a2)\
+N("otis elevator company",0x1572)\
+N("outsource engineering & mfg. inc",0x1439)\
+N("ovislink corp.",0x149c)\
+N("owl cyber defense solutions",0x19a4)\
+N("oxford instruments",0x13ba)\
+N("oxford nanopore technologies",0x1e59)\
+N("oxford semiconductor ltd",0x1415)\
+N("oxide computer company",0x01de)\
+N("pa semi, inc",0x1959)\
+N("pacific digital corp",0x15e9)\
+N("packard bell",0x109a)\
+N("packard bell b.v.",0x1631)\
+N("packet engines inc.",0x1318)\
+N("pairgain technologies",0x1605)\
+N("palit microsystems inc.",0x1569)\
+N("pan international industrial corp",0x154d)\
+N("panacom technology corp",0x14d4)\
+N("parador",0x1084)\
+N("parallax graphics",0x115b)\
+N("parallels, inc.",0x1ab8)\
+N("parascan technologies ltd",0x146b)\
+N("parsec",0x1977)\
+N("parsytec gmbh",0x1208)\
+N("patapsco designs inc",0x138f)\
+N("pathlight technology inc.",0x11b9)\
+N("patriot scientific corporation",0x137e)\
+N("pc direct",0x10f9)\
+N("pc partner limited / sapphire technology",0x174b)\
+N("pchdtv",0x7063)\
+N("pctel inc",0x134d)\
+N("pe logic corp.",0x14ca)\
+N("peak-system technik gmbh",0x001c)\
+N("peer protocols inc",0x115e)\
+N("pegatron",0x1b0a)\
+N("penta media co ltd",0x15c8)\
+N("pentek",0x12f0)\
+N("pentland systems ltd",0x13fa)\
+N("peppercon ag",0x1743)\
+N("pepperl+fuchs",0x11fe)\
+N("perceptive solutions, inc.",0x1256)\
+N("performance technologies, inc.",0x1214)\
+N("pericom semiconductor",0x12d8)\
+N("periscope engineering",0x1156)\
+N("peritek corporation",0x10f0)\
+N("perle systems ltd",0x155f)\
+N("petaio inc",0x1ee4)\
+N("pfu limited",0x1161)\
+N("phase metrics",0x13c4)\
+N("philips - crypto",0x152f)\
+N("philips business electronics b.v.",0x14b4)\
+N("philips semiconductors",0x1131)\
+N("phillips components",0x17ab)\
+N("phison electronics corporation",0x1987)\
+N("phobos corporation",0x13d8)\
+N("phoenix contact gmbh & co.",0x1442)\
+N("phoenix technologies",0x100a)\
+N("phoenix technology ltd",0x1363)\
+N("photoscript group ltd.",0x1280)\
+N("photron ltd.",0x115c)\
+N("phylon communications inc",0x1343)\
+N("phytium technology co., ltd.",0x1db7)\
+N("picazo communications",0x1475)\
+N("pickering interfaces ltd",0x1761)\
+N("pico computing",0x19de)\
+N("picopower technology",0x1066)\
+N("picture elements incorporated",0x12c5)\
+N("picture tel japan k.k.",0x11f2)\
+N("picturetel",0x101f)\
+N("pika technologies inc.",0x16df)\
+N("pine technology ltd",0x1155)\
+N("pinnacle systems inc.",0x11bd)\
+N("pinnacle systems, inc. (wrong id)",0xbd11)\
+N("pioneer electronic corporation",0x11cf)\
+N("pix stream inc",0x142d)\
+N("pixelfusion ltd",0x14e5)\
+N("pixera corporation",0x127b)\
+N("planex communications, inc",0x14ea)\
+N("plant equipment, inc.",0x148f)\
+N("platform technologies, inc.",0x1285)\
+N("plda",0x1556)\
+N("pliops",0x1e7e)\
+N("pluto technologies international",0x12cc)\
+N("plx technology, inc.",0x10b5)\
+N("pmc-sierra inc.",0x11f8)\
+N("pny",0x196e)\
+N("point multimedia systems",0x158d)\
+N("point of view bv",0x1acc)\
+N("portwell inc",0x15bb)\
+N("post impression systems.",0x3142)\
+N("power computing corp.",0x11a7)\
+N("power i/o, inc.",0x1225)\
+N("power micro research",0x15f5)\
+N("powerhouse systems",0x1110)\
+N("powertv",0x7fed)\
+N("ppt vision",0x137b)\
+N("praim srl",0x145b)\
+N("precision digital images",0x111f)\
+N("preferred networks, inc.",0x0ccd)\
+N("primex aerospace co",0x1580)\
+N("prisa networks",0x1359)\
+N("procomp informatics ltd",0x15c5)\
+N("prodasafe gmbh",0x1803)\
+N("productivity enhancement",0x1329)\
+N("progeny systems corporation",0x19ae)\
+N("prolink microsystems corp",0x1554)\
+N("promax systems inc",0x1342)\
+N("promise technology, inc.",0x105a)\
+N("prophet systems, inc.",0x12cf)\
+N("prosys-tec inc",0x1602)\
+N("protac international corp",0x155b)\
+N("proteon, inc.",0x1108)\
+N("protogate, inc.",0x17c3)\
+N("provideo multimedia co ltd",0x1540)\
+N("proxim inc",0x14b7)\
+N("psion dacom plc",0x1420)\
+N("psitech",0x12d1)\
+N("pulse-link, inc.",0x199a)\
+N("pure data ltd.",0x11a6)\
+N("pure storage",0x1d00)\
+N("purup prepress a/s",0x1216)\
+N("px instruments technology ltd",0x157f)\
+N("pyramid technology",0x11bb)\
+N("qlogic corp.",0x1077)\
+N("qlogic, corp.",0x1fc1)\
+N("qnap systems, inc.",0x1baa)\
+N("quadrant international",0x1328)\
+N("quadrics ltd",0x14fc)\
+N("qualcomm atheros",0x168c)\
+N("qualcomm inc",0x5143)\
+N("qualcomm technologies, inc",0x17cb)\
+N("qualcore logic inc.",0x1800)\
+N("quancom electronic gmbh",0x8008)\
+N("quanta computer inc",0x152d)\
+N("quanta microsystems, inc",0x1a32)\
+N("quantel",0x15c1)\
+N("quantenna communications, inc.",0x1bb5)\
+N("quantum 3d inc",0x139c)\
+N("quantum corporation",0x10a2)\
+N("quantum data corp.",0x14b6)\
+N("quantum designs (h.k.) inc",0x3411)\
+N("quantum designs (h.k.) ltd",0x1098)\
+N("quantum nebula microelectronics technology co.,ltd.",0x1eb4)\
+N("quatech inc",0x135c)\
+N("quectel wireless solutions co., ltd.",0x1eac)\
+N("questra corporation",0x11dc)\
+N("quicklogic corporation",0x11e3)\
+N("quicknet technologies inc",0x15e2)\
+N("quickturn design systems",0x152a)\
+N("quixant limited",0x19d4)\
+N("racal airtech ltd",0x1552)\
+N("racore",0x2348)\
+N("racore computer products, inc.",0x10ef)\
+N("radian memory systems inc.",0x1cc7)\
+N("radicom research inc",0x142f)\
+N("radiolan",0x142b)\
+N("radisys corporation",0x1331)\
+N("radius",0x10ce)\
+N("radstone technology",0x12f3)\
+N("radstone technology plc",0x11b5)\
+N("rainbow technologies",0x12de)\
+N("ralink corp.",0x1814)\
+N("ralink corp. (wrong id)",0x1804)\
+N("ramaxel technology(shenzhen) limited",0x1e81)\
+N("rambus inc.",0x10c6)\
+N("rascom inc",0x13a4)\
+N("rasterops corp.",0x1104)\
+N("ratoc system inc",0x1195)\
+N("ravicad",0x112d)\
+N("raycer inc",0x14e8)\
+N("raychem",0x1513)\
+N("raytheion e-systems",0x13ed)\
+N("raytheon company",0x10b2)\
+N("raza microelectronics, inc.",0x182e)\
+N("razer usa ltd.",0x1a58)\
+N("rdc semiconductor, inc.",0x17f3)\
+N("reality simulation systems inc",0x1384)\
+N("realtek semiconductor co., ltd.",0x10ec)\
+N("red hat, inc.",0x1af4)\
+N("redcreek communications inc",0x4916)\
+N("redcreek communications, inc",0x1334)\
+N("reflex ces",0x1bad)\
+N("rendition",0x1163)\
+N("renesas technology corp.",0x1912)\
+N("reply group",0x1006)\
+N("research centre juelich",0x1796)\
+N("resilience corporation",0x18fb)\
+N("retix corporation",0x128c)\
+N("rhetorex, inc.",0x1294)\
+N("rhino equipment corp.",0x0b0b)\
+N("ricoh co ltd",0x1180)\
+N("rios systems co ltd",0x1399)\
+N("rioworks",0x161f)\
+N("rivet networks",0x1a56)\
+N("rlx technologies",0x1749)\
+N("rme",0x1d18)\
+N("road corp",0x1534)\
+N("rockchip electronics co., ltd",0x1d87)\
+N("rockwell international",0x127a)\
+N("rockwell-collins inc",0x15d7)\
+N("rohde & schwarz dvs gmbh",0x1a55)\
+N("rohm lsi systems, inc.",0x10db)\
+N("roland corp.",0x16ce)\
+N("ropex industrie-elektronik gmbh",0x2bd8)\
+N("ross technology",0x110f)\
+N("rosun technologies inc",0x1512)\
+N("rtd embedded technologies, inc.",0x1435)\
+N("ruby tech corp.",0x146c)\
+N("s s technologies",0x5136)\
+N("s-mos systems, inc.",0x10f4)\
+N("s. a. telecommunications",0x1267)\
+N("s3 graphics ltd.",0x5333)\
+N("safenet (wrong id)",0x0001)\
+N("safenet inc",0x16ae)\
+N("sage microelectronics corp.",0x1dd3)\
+N("sahara networks, inc.",0x1284)\
+N("salient systems corp",0x140f)\
+N("salix technologies, inc",0x1325)\
+N("samsung electro-mechanics co., ltd.",0x167d)\
+N("samsung electronics co ltd",0x144d)\
+N("samsung electronics co., ltd",0x1099)\
+N("samsung electronics co., ltd.",0x1249)\
+N("samsung information systems america",0x11e2)\
+N("samsung semiconductors, inc.",0x10c3)\
+N("sanblaze technology, inc.",0x1ae3)\
+N("sand microelectronics",0x11c2)\
+N("sandisk",0x1aed)\
+N("sandisk corp",0x15b7)\
+N("sanera systems, inc.",0x175e)\
+N("sangoma technologies corp.",0x1923)\
+N("sanritz automation co ltd",0x1380)\
+N("santa cruz operation",0x1111)\
+N("sanyo electric co - computer engineering dept",0x113e)\
+N("sanyo technosound co ltd",0x13bb)\
+N("sap",0x8686)\
+N("sapeon inc.",0x1f56)\
+N("sapphire technology limited",0x1da2)\
+N("sapphire, inc.",0x0721)\
+N("satelco ingenieria s.a.",0x3112)\
+N("sbe incorporated",0x1176)\
+N("sbs technologies",0x108a)\
+N("sbs technologies inc",0x12df)\
+N("sbs/greenspring modular i/o",0x124b)\
+N("scalable networks, inc.",0x12a6)\
+N("scaleflux inc.",0xcc53)\
+N("scanlab ag",0x5452)\
+N("schooner information technology, inc.",0x1b40)\
+N("schweitzer engineering laboratories",0x1aa9)\
+N("sci systems inc",0x1209)\
+N("science and research centre of computer technology (jsc \"nicevt\")",0x1c63)\
+N("scientific atlanta",0x11f7)\
+N("scii telecom",0x1480)\
+N("scimetric instruments inc",0x1609)\
+N("scion corporation",0x11ff)\
+N("scitex digital video",0xaa42)\
+N("scm microsystems",0x133f)\
+N("scm microsystems, inc.",0x0432)\
+N("sdl communications, inc.",0x12aa)\
+N("seachange international",0x1326)\
+N("seagate technology plc",0x1bb1)\
+N("seakr engineering",0x1a0d)\
+N("sealevel systems inc",0x135e)\
+N("seanix technology inc",0x4ca1)\
+N("second wave inc",0x11e4)\
+N("sectra ab",0x17e4)\
+N("secunet security networks ag",0x1cdd)\
+N("seeq technology, inc.",0x123b)\
+N("sega enterprises ltd",0x11db)\
+N("seh computertechnik gmbh",0x1581)\
+N("seiko epson corp",0x14eb)\
+N("seiko epson corporation",0x103a)\
+N("seiko instruments inc",0x149b)\
+N("semtech corporation",0x14bb)\
+N("sensory networks inc.",0x196a)\
+N("sequent computer systems",0x106d)\
+N("serome technology inc",0x15c9)\
+N("servotest ltd",0x154e)\
+N("seskion gmbh",0x1cd2)\
+N("shanghai communications technologies center",0x15a8)\
+N("shanghai enflame technology co. ltd",0x1e36)\
+N("shannon systems",0x1cb0)\
+N("sharewave inc",0x13bf)\
+N("shark multimedia inc",0x13d2)\
+N("sharp corporation",0x13bd)\
+N("shenzhen colorful yugong technology and development co.",0x7377)\
+N("shenzhen gunnir technology development co., ltd",0x1ef7)\
+N("shenzhen longsys electronics co., ltd.",0x1d97)\
+N("shenzhen shichuangyi electronics co., ltd",0x1f03)\
+N("shenzhen tigo semiconductor",0x1df5)\
+N("shenzhen unionmemory information system ltd.",0x1cc4)\
+N("shf communication technologies ag",0x0eac)\
+N("shima seiki manufacturing ltd.",0x1188)\
+N("shining technology inc",0x14e6)\
+N("shiva corporation",0x11c5)\
+N("shiva europe limited",0xb1b3)\
+N("si logic ltd",0x1559)\
+N("sican gmbh",0x122c)\
+N("siemens ag",0x110a)\
+N("siemens industry software inc.",0x14ab)\
+N("siemens medical systems, ultrasound group",0x13a9)\
+N("siemens nixdorf is",0x1029)\
+N("sierra research and technology",0x11a2)\
+N("sierra semiconductor",0x10a8)\
+N("sietium semiconductor co., ltd.",0x8510)\
+N("sifive, inc.",0xf15e)\
+N("sigma designs corporation",0x1236)\
+N("sigma designs, inc.",0x1105)\
+N("sigmatel",0x8384)\
+N("sigmatel inc",0x15dd)\
+N("signal processing devices sweden ab",0x1b37)\
+N("signatec / dynamic signals corp",0x1b94)\
+N("siig inc",0x131f)\
+N("silicom denmark",0x1c2c)\
+N("silicom ltd.",0x1374)\
+N("silicom multimedia systems inc",0x13e1)\
+N("silicon engineering",0x1177)\
+N("silicon graphics intl. corp.",0x10a9)\
+N("silicon image, inc.",0x1095)\
+N("silicon image, inc. (wrong id)",0x0095)\
+N("silicon integrated systems [sis]",0x1039)\
+N("silicon laboratories",0x1543)\
+N("silicon magic",0x11fc)\
+N("silicon motion, inc.",0x126f)\
+N("silicon reality",0x138c)\
+N("silicon spice inc",0x13ff)\
+N("silicon vision inc",0x1373)\
+N("silver creations ag",0x1aab)\
+N("silverback",0x1864)\
+N("simpact associates, inc.",0x12a1)\
+N("simplivity corporation",0x1bb0)\
+N("simutech, inc.",0x123e)\
+N("sirrix ag security technologies",0xaffe)\
+N("sitecom europe bv",0x182d)\
+N("sitecom europe bv (wrong id)",0x18d2)\
+N("sk hynix",0x1c5c)\
+N("sk-electronics co., ltd.",0x0315)\
+N("skyware corporation",0x1368)\
+N("slac national accelerator lab tid-air",0x1a4a)\
+N("sma regelsysteme gmbh",0x1497)\
+N("smart electronic development gmbh",0x1551)\
+N("smart link ltd.",0x10a5)\
+N("smart modular technologies",0x1235)\
+N("smartinfra ltd",0x631c)\
+N("smsc automotive infotainment system group",0x1853)\
+N("sodick america corp.",0x8322)\
+N("softcom microsystems",0x133b)\
+N("softing gmbh",0x14a0)\
+N("softlab-nsk",0x1c1f)\
+N("softlogic co., ltd.",0x9413)\
+N("sola electronics",0x15be)\
+N("solarflare communications",0x1924)\
+N("solectron",0x1527)\
+N("solid state storage technology corporation",0x1e95)\
+N("solidigm",0x025e)\
+N("solidrun",0xd063)\
+N("solidum systems corp",0x1588)\
+N("soliton systems k.k.",0x1361)\
+N("solitron technologies, inc.",0x124c)\
+N("solliday engineering",0x103e)\
+N("soltek computer inc.",0x1919)\
+N("sonic solutions",0x1263)\
+N("sonix inc",0x1351)\
+N("sonnet technologies, inc.",0x16b8)\
+N("sony",0xa304)\
+N("sony corporation",0x104d)\
+N("sopac ltd",0x14f5)\
+N("sord computer corporation",0x1290)\
+N("sorenson vision inc",0x12f1)\
+N("source technology inc",0x15b1)\
+N("soyo computer, inc",0x10fd)\
+N("sp3d chip design gmbh",0x1451)\
+N("sparklan communications, inc.",0x16af)\
+N("spea software ag",0x1017)\
+N("specialix research ltd.",0x11cb)\
+N("specialvideo engineering srl",0x125e)\
+N("spectracom corporation",0x1ad7)\
+N("spectrum gmbh",0x18f1)\
+N("spectrum signal processing",0x12fb)\
+N("spectrum-4tor",0xcf86)\
+N("speedstream",0x02ac)\
+N("spellcaster telecommunications inc.",0x1298)\
+N("sphere communications",0x1324)\
+N("spider communications inc.",0x14bf)\
+N("spin master ltd.",0x1ade)\
+N("splash technology, inc.",0x126d)\
+N("squirrels research labs",0x1e24)\
+N("ss technologies",0x133d)\
+N("sse telecom inc",0x15a7)\
+N("stallion technologies, inc.",0x124d)\
+N("standard microsystems corp [smc]",0x10b8)\
+N("star electronics gmbh & co. kg",0x1974)\
+N("star multimedia corp",0x157b)\
+N("starbridge, inc.",0x1a8a)\
+N("stargate solutions inc",0x143a)\
+N("stargen inc.",0x9902)\
+N("stb systems inc",0x10b4)\
+N("stec, inc.",0x1b39)\
+N("stmicroelectronics",0x104a)\
+N("stone microsystems pty ltd.",0x1490)\
+N("stone ridge technology",0x1618)\
+N("storage technology corp.",0x1426)\
+N("stratabeam technology",0x154f)\
+N("stratus computer systems",0x159c)\
+N("stratus computers",0x1107)\
+N("streamlabs",0x1fcc)\
+N("stretch inc.",0x18a2)\
+N("stryker corporation",0x8820)\
+N("studio audio & video ltd",0x13cf)\
+N("subspace dynamics",0x1cf7)\
+N("sumitomo electric industries, ltd.",0x1349)\
+N("sumitomo metal industries, ltd.",0x126e)\
+N("sundance technology inc / ic plus corp",0x13f0)\
+N("sunix co., ltd.",0x1fd4)\
+N("sunlight ultrasound technologies ltd",0x15a6)\
+N("sunsgroup corporation",0x12e7)\
+N("super micro computer inc",0x15d9)\
+N("supermac technology",0x1081)\
+N("surecom technology",0x10bd)\
+N("suse llc",0x1ee9)\
+N("suzhou kuhan information technologies",0x1ee1)\
+N("suzhou xiongli technology inc.",0xffe1)\
+N("swissbit ag",0x1dd4)\
+N("switched network technologies, inc.",0x1276)\
+N("syba tech ltd",0x1592)\
+N("sycron n. v.",0x16ed)\
+N("symbios logic inc",0x11f1)\
+N("symbol technologies",0x1562)\
+N("symicron computer communication ltd.",0x12dc)\
+N("symphony",0x1c1c)\
+N("symphony labs",0x10ad)\
+N("synaptel",0x120a)\
+N("synopsys, inc.",0x16c3)\
+N("synopsys/logic modeling group",0x103f)\
+N("syskonnect",0x1148)\
+N("sysmic, inc.",0x131d)\
+N("systec co. ltd",0x1350)\
+N("systech corp.",0x11a8)\
+N("system talks inc.",0x1a5f)\
+N("system-on-chip engineering s.l.",0x50ce)\
+N("systembase co ltd",0x14a1)\
+N("systemsoft",0x108f)\
+N("systran corp",0x1387)\
+N("t-square design inc.",0x8866)\
+N("t.sqware",0x13af)\
+N("t/r systems",0x117e)\
+N("t1042 [freescale]",0x0824)\
+N("tachyon, inc.",0x146d)\
+N("taiwan mycomp co ltd",0x15c3)\
+N("tamarack microelectronics inc",0x143d)\
+N("tamura corporation",0x13b1)\
+N("tandem computers",0x10e4)\
+N("tata power strategic electronics division",0x4321)\
+N("tateno dennou, inc.",0x128f)\
+N("tateyama system laboratory co ltd",0x15c7)\
+N("tatung co",0x15d5)\
+N("tatung corp. of america",0x103b)\
+N("tbs technologies",0x544d)\
+N("tbs technologies (wrong id)",0x6205)\
+N("tdk semiconductor corp.",0x1626)\
+N("tdk usa corp",0x12af)\
+N("tec corporation",0x11d9)\
+N("techman electronics (changshu) co., ltd.",0x1d40)\
+N("technical corp.",0x120c)\
+N("technical university of budapest",0x15c6)\
+N("technische universitaet berlin",0x5455)\
+N("techno chips co. ltd",0x13b2)\
+N("technobox, inc.",0x1d61)\
+N("technotrend systemtechnik gmbh",0x13c2)\
+N("techsan electronics co ltd",0x13d0)\
+N("techsoft technology co ltd",0x14b8)\
+N("techwell inc",0x153e)\
+N("tedia spol. s r. o.",0x1760)\
+N("tehuti networks ltd.",0x1fc9)\
+N("teijin seiki co. ltd",0x1366)\
+N("tek microsystems inc.",0x14cf)\
+N("tekelec telecom",0x11d6)\
+N("teko telecom s.r.l.",0x1da1)\
+N("tekram technology co.,ltd.",0x10e1)\
+N("tektronix",0x1268)\
+N("teledyne electronic systems",0x111b)\
+N("teledyne lecroy",0x1570)\
+N("telefon aktiebolaget lm ericsson",0x1519)\
+N("telemann co. ltd",0x1378)\
+N("telematics international",0x1272)\
+N("teles ag",0x13a7)\
+N("teles ag (wrong id)",0x00a7)\
+N("telesoft design ltd",0x13e5)\
+N("telesynergy research inc.",0x1612)\
+N("telmatics international",0x1181)\
+N("temporal research ltd",0x2001)\
+N("tenafe, inc.",0xfe19)\
+N("tencent technology (shenzhen) company limited",0x1ea0)\
+N("tenstorrent inc",0x1e52)\
+N("tenta technology",0x1601)\
+N("teradata corp.",0x1b3e)\
+N("teradici corp.",0x6549)\
+N("teradyne inc",0x1316)\
+N("teralogic inc",0x544c)\
+N("terayon communications systems",0x1560)\
+N("terratec electronic gmbh",0x153b)\
+N("tews technologies gmbh",0x1498)\
+N("texas instruments",0x104c)\
+N("texas memory systems inc",0x15b6)\
+N("texas microsystems",0x1065)\
+N("tfl lan inc",0x1514)\
+N("thales",0x1269)\
+N("thales computers",0x184a)\
+N("the logical co",0x1356)\
+N("thesys gesellschaft fuer mikroelektronik mbh",0x10fb)\
+N("thine electronics inc",0x1168)\
+N("thinking machines corp",0x1150)\
+N("third planet publishing",0x1337)\
+N("thorlabs",0x1ddd)\
+N("tiger jet network inc. (wrong id)",0x0059)\
+N("tiger jet network inc. / icp das",0xe159)\
+N("tiger lake-h gaussian & neural accelerator",0x9a11)\
+N("tilera corp.",0x1a41)\
+N("time logic corporation",0x1492)\
+N("time space radio ab",0x14ad)\
+N("timedia technology co ltd",0x1409)\
+N("times n systems inc",0x15f1)\
+N("timestep corporation",0x1288)\
+N("titan electronics inc",0x14d2)\
+N("tmc research",0x1030)\
+N("tokai communications industry co. ltd",0x1495)\
+N("tokimec inc",0x138b)\
+N("tokyo denshi sekei k.k.",0x15ea)\
+N("tokyo electron device ltd.",0x1679)\
+N("tokyo electronic industry co ltd",0x14f4)\
+N("tongfang hongkong limited",0x1d05)\
+N("topdek semiconductor inc.",0x17f7)\
+N("topic semiconductor corp",0x151f)\
+N("topspin communications",0x1867)\
+N("toray industries inc",0x1479)\
+N("toshiba america",0x102f)\
+N("toshiba america, elec. company",0x11e7)\
+N("toshiba corporation",0x1179)\
+N("toshiba engineering corporation",0x13d7)\
+N("toucan technology",0x1194)\
+N("toyota macs inc",0x15a5)\
+N("tp-link technologies co., ltd.",0x7470)\
+N("trancell systems inc",0x11d3)\
+N("transas marine (uk) ltd",0x14fb)\
+N("transcend information, inc.",0x1d79)\
+N("transdimension",0x192e)\
+N("transition networks",0x157e)\
+N("transmeta corporation",0x1279)\
+N("transtech parallel systems ltd.",0x1278)\
+N("transwitch corporation",0x128b)\
+N("trendnet",0x1976)\
+N("trendware international inc.",0x8401)\
+N("trenton technology, inc.",0x11d7)\
+N("tricord systems inc.",0x111c)\
+N("trident microsystems",0x1023)\
+N("trigem computer inc.",0x109f)\
+N("tripace",0x1190)\
+N("tritech microelectronics inc",0x1292)\
+N("troika networks, inc.",0x13f4)\
+N("true time inc.",0x12da)\
+N("truevision",0x10fa)\
+N("trw",0x1444)\
+N("trx",0x8912)\
+N("tseng labs inc",0x100c)\
+N("tseng labs international co.",0x10be)\
+N("tsf5 corporation",0x1c8a)\
+N("tsi telsys",0xc001)\
+N("tttech computertechnik ag",0x1c7e)\
+N("tttech computertechnik ag (wrong id)",0x0357)\
+N("tul corporation / powercolor",0x148c)\
+N("tundra semiconductor corp.",0x10e3)\
+N("turbocomm tech. inc.",0x14c8)\
+N("tut systems inc",0x1449)\
+N("twinhan technology co. ltd",0x1822)\
+N("twinhead international corp",0x14ff)\
+N("txic",0x4651)\
+N("tyan computer",0x10f1)\
+N("tyzx, inc.",0xcddd)\
+N("u.s. robotics",0x16ec)\
+N("uakron pci project",0xb10b)\
+N("ubiquiti networks, inc.",0x0777)\
+N("uli electronics inc.",0x10b9)\
+N("ulsi systems",0x1003)\
+N("ulticom (formerly dgm&s)",0x12d4)\
+N("ultimarc",0xd209)\
+N("ultrastor",0x6356)\
+N("ultraview corp.",0xfebd)\
+N("umax computer corp",0x4680)\
+N("unex technology corp.",0x1429)\
+N("unibrain s.a.",0x1443)\
+N("unifabrix ltd.",0x1fab)\
+N("unisys corporation",0xa0f1)\
+N("unisys systems",0x1018)\
+N("united microelectronics [umc]",0x1060)\
+N("united video corp",0x11b6)\
+N("universal global scientific industrial co.,ltd",0x14cd)\
+N("universall answer generators",0x4242)\
+N("university of toronto",0x5045)\
+N("uniwill computer corp",0x1584)\
+N("untether ai",0x1e67)\
+N("utimaco is gmbh",0x168a)\
+N("v&g information system co.,ltd",0x1df8)\
+N("v3 semiconductor inc.",0x11b0)\
+N("vadatech inc.",0xabcd)\
+N("vadem",0x10e7)\
+N("valley technologies inc",0x15e5)\
+N("valuesoft",0x15f4)\
+N("valve software",0x1e44)\
+N("varian australia pty ltd",0xca50)\
+N("varisys ltd",0x1888)\
+N("vastai technologies",0x1ec6)\
+N("vector fabrics bv",0x5646)\
+N("vector informatik gmbh",0x19e2)\
+N("vela research",0x127d)\
+N("verigy pte. ltd.",0x1a8c)\
+N("verint systems inc.",0x144b)\
+N("verisilicon inc",0x1eb1)\
+N("vertex networks, inc.",0x1257)\
+N("via technologies inc.",0x1412)\
+N("via technologies, inc.",0x1106)\
+N("via technologies, inc. (wrong id)",0x0925)\
+N("victor company of japan, ltd.",0x129e)\
+N("vidac electronics gmbh",0x156c)\
+N("video domain technologies",0x1386)\
+N("video logic, ltd.",0x1010)\
+N("video transcode controller",0x2a18)\
+N("videomail, inc",0x1335)\
+N("videonics inc",0x13a6)\
+N("videoserver connections",0x1424)\
+N("videoserver, inc",0x1311)\
+N("videotele.com, inc.",0x16f6)\
+N("videotron corp",0x11ba)\
+N("vienna systems",0x12ef)\
+N("viewcast com",0x1576)\
+N("viewgraphics inc",0x1561)\
+N("vigra",0x1126)\
+N("vingmed sound a/s",0x12d3)\
+N("violin memory, inc",0x1a73)\
+N("virident systems inc.",0x1a78)\
+N("virtensys limited",0x1a68)\
+N("virtual computer corp",0x133e)\
+N("viscore technologies ltd",0x1eec)\
+N("visicom laboratories, inc.",0x123a)\
+N("vision dynamics ltd.",0x12a5)\
+N("visiontech ltd",0x141f)\
+N("visiontek",0x1545)\
+N("vista controls corp",0x1201)\
+N("visual technology inc",0x154c)\
+N("vitec multimedia",0x142e)\
+N("vitesse semiconductor",0x101b)\
+N("vixs systems, inc.",0x1745)\
+N("vlsi solutions oy",0x1251)\
+N("vlsi technology inc",0x1004)\
+N("vmetro, inc.",0x129a)\
+N("vmic",0x114a)\
+N("vmware",0x15ad)\
+N("vmware inc (temporary id)",0xfffe)\
+N("voarx r & d inc",0x1158)\
+N("voice technologies group inc",0x15e1)\
+N("voicetronix pty ltd",0x5654)\
+N("voltaire advanced data security ltd",0x1575)\
+N("voss scientific",0x1327)\
+N("voyetra technologies",0x5053)\
+N("vsn systemen bv",0x15e4)\
+N("vtech computers ltd",0x105e)\
+N("vtel corp",0x133a)\
+N("vti instruments corporation",0x1bf4)\
+N("vvdn technologies private limited",0x1f44)\
+N("vweb corp",0x16f4)\
+N("wandel & goltermann",0x14fa)\
+N("warpspped inc",0x150d)\
+N("wavesat",0x1315)\
+N("wch.cn",0x4348)\
+N("weitek",0x100e)\
+N("wellbean co inc",0x13b4)\
+N("wellx telecom sa",0x174d)\
+N("westar display technologies",0x1b3a)\
+N("western digital",0x101c)\
+N("whistle communications",0x14ce)\
+N("wildfire communications",0x13f7)\
+N("williams electronics games, inc.",0x146e)\
+N("wilocity ltd.",0x1ae9)\
+N("win system corporation",0x1149)\
+N("winbond",0x8c4a)\
+N("winbond electronics corp",0x1050)\
+N("wingtech group(hongkong)limited",0x1ec9)\
+N("winnov, l.p.",0x127e)\
+N("winradio communications",0x186f)\
+N("wintop technology, inc.",0x1494)\
+N("wipro infotech limited",0x105c)\
+N("wired inc.",0x0795)\
+N("wistron corp.",0x17c0)\
+N("wistron neweb corp.",0x185f)\
+N("wolf technology inc",0x14f7)\
+N("wolfson microelectronics",0x1aec)\
+N("woodward mccoach, inc.",0x1231)\
+N("workbit corporation",0x1145)\
+N("workstation technology",0x116f)\
+N("worldspace corp.",0x1661)\
+N("wyse technology inc.",0x102d)\
+N("x-es, inc.",0x5845)\
+N("x-net oy",0x15a4)\
+N("xantel corporation",0x270b)\
+N("xavi technologies corp.",0x1b9a)\
+N("xdx computing technology ltd.",0x1eed)\
+N("xensource, inc.",0x1a71)\
+N("xerox corporation",0x10c5)\
+N("xfusion digital technologies co., ltd.",0x1f24)\
+N("xfx limited",0x1eae)\
+N("xfx pine group inc.",0x1682)\
+N("xfx pine group inc. (wrong id)",0x02e0)\
+N("xgi technology inc. (extreme graphics innovation)",0x18ca)\
+N("xiaomi",0x1d72)\
+N("xilinx corporation",0x10ee)\
+N("ximea",0xdeda)\
+N("xinex networks inc",0x131e)\
+N("xionics document technologies inc",0x14a5)\
+N("xiotech corporation",0x12a9)\
+N("xircom",0x115d)\
+N("xorcom",0xe4e4)\
+N("xpeed inc",0x14b3)\
+N("xpoint technologies, inc",0x11b8)\
+N("xsigo systems",0x199d)\
+N("xylon research, inc.",0x1247)\
+N("xyratex",0x122e)\
+N("yadro",0x1d93)\
+N("yamaha corporation",0x1073)\
+N("yamakatsu electronics industry co ltd",0x1564)\
+N("yamashita systems corp",0x150b)\
+N("yamatake-honeywell co. ltd",0x130e)\
+N("yangtze memory technologies co.,ltd",0x1e49)\
+N("yano electric co ltd",0x13cb)\
+N("yaskawa electric co.",0x1313)\
+N("yeestor microelectronics co., ltd",0x1d89)\
+N("yeston",0x1ed3)\
+N("ygrec systems co ltd",0x1422)\
+N("yokogawa electric corporation",0x1281)\
+N("yottayotta inc.",0x170c)\
+N("young micro systems",0x1053)\
+N("yuan high-tech development co., ltd.",0x12ab)\
+N("yunsilicon technology co,. ltd.",0x1f67)\
+N("z-com, inc.",0x17cf)\
+N("zapex technologies inc",0x1473)\
+N("zeal corporation",0x1491)\
+N("zeitnet inc.",0x1193)\
+N("zenith data systems",0x112c)\
+N("zenith electronics corp",0x15f9)\
+N("zhaoxin",0x1d17)\
+N("ziatech corporation",0x1138)\
+N("zida technologies ltd.",0x109d)\
+N("zilog",0x1121)\
+N("zilog inc",0x15fb)\
+N("znyx advanced systems",0x110d)\
+N("zoltrix international ltd",0x15b0)\
+N("zonet",0x31ab)\
+N("zoom corporation",0x1ccf)\
+N("zoom telephonics inc",0x141b)\
+N("zoran corporation",0x11de)\
+N("zotac international (mco) ltd.",0x19da)\
+N("zt systems",0x6899)\
+N("zuken",0x12ea)\
+N("zycoo co., ltd",0x6688)\
+N("zydacron inc",0x13ec)\
+N("zydas technology corp.",0x167b)\
+N("zyxel communications corp.",0x19ba)\
+N("zyxel communications corporation",0x187e)\
+N("zyxel communications corporation (wrong id)",0x0308)\
+
 #define PCIIDS_DEVICES \
 P(0x00108139,"AT-2500TX V3 Ethernet")\
 P(0x00147a00,"Hyper Transport Bridge Controller")\
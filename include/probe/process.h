@@ -4,7 +4,10 @@
 #include "probe/dllport.h"
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #ifdef __linux__
@@ -46,11 +49,23 @@ namespace probe::process
     {
         uint64_t    tid{};
         std::string name{};
+
+        int      state{};                      // linux only
+        uint64_t utime{};                      // ns, linux only, scheduled in user mode
+        uint64_t stime{};                      // ns, linux only, scheduled in kernel mode
+        int      processor{};                  // linux only, CPU number last executed on
+        uint64_t voluntary_ctxt_switches{};    // linux only
+        uint64_t nonvoluntary_ctxt_switches{}; // linux only
     };
 
     // probe all process
     PROBE_API std::vector<process_t> processes();
 
+    // probe all process by a pool of worker threads, each scanning a contiguous part of the process list,
+    // 0 for std::thread::hardware_concurrency()
+    // Windows: the snapshot is enumerated by the calling thread
+    PROBE_API std::vector<process_t> processes(size_t nb_threads);
+
     // get pid of current process
     PROBE_API int64_t id();
 
@@ -63,6 +78,10 @@ namespace probe::process
     // get all threads of the process
     PROBE_API std::vector<thread_t> threads(uint64_t);
 
+    // get all threads of the process into the caller-provided vector, the elements are reused to avoid
+    // reallocation when polling. return false if the process does not exist
+    PROBE_API bool threads(uint64_t, std::vector<thread_t>&);
+
     // bytes
     PROBE_API uint64_t memory(uint64_t);
 } // namespace probe::process
@@ -226,6 +245,9 @@ namespace probe::process
         uint64_t capeff;
         uint64_t capbnd;
         uint64_t capamb;
+
+        unsigned long voluntary_ctxt_switches;    // Number of voluntary context switches
+        unsigned long nonvoluntary_ctxt_switches; // Number of involuntary context switches
     };
 
     // proc/uptime
@@ -233,10 +255,22 @@ namespace probe::process
     // return zero if failed
     PROBE_API uint64_t uptime();
 
+    // reads /proc/<path> into the caller-owned buffer by a single read(2), the file is opened by openat(2)
+    // relative to a cached /proc descriptor.
+    // return the content, or an empty view if failed. the content is truncated to the size of the buffer
+    PROBE_API std::string_view read_proc(const char *, std::span<char>);
+
     // /proc/[pid]/stat
     PROBE_API pstat_t parse_stat(uint64_t);
     PROBE_API pstat_t parse_stat(const std::string&);
 
+    // reads /proc/[pid]/stat into the caller-owned buffer (1 KiB is enough) and parses it without any heap
+    // allocation, return false if the process does not exist
+    PROBE_API bool parse_stat(uint64_t, pstat_t&, std::span<char>);
+
+    // parses the content of /proc/[pid]/stat
+    PROBE_API bool parse_stat_text(std::string_view, pstat_t&);
+
     // /proc/[pid]/io
     PROBE_API pio_t parse_io(uint64_t);
     PROBE_API pio_t parse_io(const std::string&);
@@ -249,6 +283,13 @@ namespace probe::process
     PROBE_API pstatus_t parse_status(uint64_t);
     PROBE_API pstatus_t parse_status(const std::string&);
 
+    // reads /proc/[pid]/status into the caller-owned buffer and parses it in one pass. a status that fills
+    // the buffer, e.g. with many supplementary groups, is read again into a larger heap buffer
+    PROBE_API bool parse_status(uint64_t, pstatus_t&, std::span<char>);
+
+    // parses the content of /proc/[pid]/status
+    PROBE_API bool parse_status_text(std::string_view, pstatus_t&);
+
     // /proc/[pid]/environ
     PROBE_API std::string parse_environ(uint64_t);
     PROBE_API std::string parse_environ(const std::string&);
@@ -261,6 +302,80 @@ namespace probe::process
     //  - This file exposes the process's comm value—that is, the command name associated with the process.
     PROBE_API std::string parse_comm(uint64_t);
     PROBE_API std::string parse_comm(const std::string&);
+
+    // incremental process table
+    //  - every process is keyed by (pid, starttime), so a reused pid is reported as removed + added
+    //  - the static fields (path, cmdline, user) are read only once when the process is first seen
+    //  - the known processes only re-read /proc/[pid]/stat on every update
+    class snapshotter
+    {
+    public:
+        struct delta_t
+        {
+            std::vector<process_t> added{};
+            std::vector<process_t> changed{}; // ppid, state, priority, name or nb_threads changed, the
+                                              // path, cmdline and user are read again with a new name
+            std::vector<process_t> removed{};
+        };
+
+        // re-scans /proc and returns the difference from the previous update,
+        // all processes are reported as added by the first update
+        PROBE_API delta_t update();
+
+        // all processes as of the last update, in no particular order
+        PROBE_API std::vector<process_t> processes() const;
+
+        PROBE_API size_t size() const { return entries_.size(); }
+
+    private:
+        struct entry_t
+        {
+            unsigned long long starttime{}; // clock ticks, /proc/[pid]/stat
+            uint64_t           generation{};
+            process_t          process{};
+        };
+
+        std::unordered_map<int64_t, entry_t> entries_{};
+        uint64_t                             generation_{};
+    };
+
+    struct cpu_usage_t
+    {
+        int64_t pid{};
+        double  usage{};  // %, user + system, relative to one CPU (exceeds 100 for multi-threaded processes)
+        double  user{};   // %
+        double  system{}; // %
+        double  minflt{}; // minor faults per second
+        double  majflt{}; // major faults per second
+    };
+
+    // per-process CPU utilisation between two samples of /proc/[pid]/stat
+    //  - the tick counts of the previous sample are kept in a flat open-addressing table keyed by
+    //    (pid, starttime), the tables are swapped by each sample instead of being reallocated
+    //  - the processes started since the previous sample are not reported
+    class cpu_sampler
+    {
+    public:
+        // returns the usage of every process since the previous sample, empty for the first sample.
+        // the result is reused and only valid until the next sample
+        PROBE_API const std::vector<cpu_usage_t>& sample();
+
+    private:
+        struct slot_t
+        {
+            int64_t            pid{}; // 0 for empty slots
+            unsigned long long starttime{};
+            unsigned long      utime{};
+            unsigned long      stime{};
+            unsigned long      minflt{};
+            unsigned long      majflt{};
+        };
+
+        std::vector<slot_t>      prev_{};
+        std::vector<slot_t>      curr_{};
+        std::vector<cpu_usage_t> usages_{};
+        uint64_t                 time_{}; // ns, relative_time() of the previous sample
+    };
 #endif
 } // namespace probe::process
 
@@ -4,7 +4,14 @@
 #include "probe/dllport.h"
 #include "probe/types.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
 // System Management BIOS
@@ -121,16 +128,146 @@ namespace probe::smbios
         std::vector<const char *> strings{};
     };
 
+    // a structure of the table, pointing into the blob, the strings are resolved on access
+    struct structure_t
+    {
+        type_t         type{};
+        uint8_t        length{}; // of the formatted area, including the header
+        uint16_t       handle{};
+        const uint8_t *data{};    // the formatted area, starting with the header
+        const char    *strings{}; // the string-set following the formatted area
+        const char    *end{};     // past the double null terminating the string-set
+
+        // the formatted area after the header, the fields beyond the length are zero
+        template<typename T> T fields() const
+        {
+            T value{};
+            std::memcpy(&value, data + sizeof(header_t), std::min<size_t>(sizeof(T), length - sizeof(header_t)));
+            return value;
+        }
+
+        // the 1-based string, empty if the index is 0 or out of range
+        std::string_view string(uint8_t index) const
+        {
+            if (index == 0) return {};
+
+            for (auto str = strings; str < end && *str; --index) {
+                const auto len = ::strnlen(str, static_cast<size_t>(end - str));
+                if (index == 1) return { str, len };
+
+                str += len + 1;
+            }
+            return {};
+        }
+    };
+
+    // non-owning, iterable view of the structure table of a DMI blob, nothing is copied or allocated.
+    // the iteration ends by the End-of-Table structure or an incomplete structure
+    class table_view
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = structure_t;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const structure_t *;
+            using reference         = const structure_t&;
+
+            iterator() = default;
+
+            iterator(const uint8_t *pos, const uint8_t *end)
+                : end_(end)
+            {
+                load(pos);
+            }
+
+            reference operator*() const { return current_; }
+
+            pointer operator->() const { return &current_; }
+
+            iterator& operator++()
+            {
+                load(current_.type == type_t::EndOfTable ? end_
+                                                         : reinterpret_cast<const uint8_t *>(current_.end));
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto it = *this;
+                ++*this;
+                return it;
+            }
+
+            bool operator==(const iterator& other) const { return current_.data == other.current_.data; }
+
+        private:
+            void load(const uint8_t *pos)
+            {
+                current_ = {};
+                if (!pos || end_ - pos < static_cast<std::ptrdiff_t>(sizeof(header_t))) return;
+
+                const uint8_t length = pos[1];
+                if (length < sizeof(header_t) || end_ - pos < length) return;
+
+                // the string-set is terminated by a double null
+                for (auto str = pos + length; str + 1 < end_; ++str) {
+                    if (str[0] == 0 && str[1] == 0) {
+                        current_ = {
+                            .type    = static_cast<type_t>(pos[0]),
+                            .length  = length,
+                            .handle  = static_cast<uint16_t>(pos[2] | (pos[3] << 8)),
+                            .data    = pos,
+                            .strings = reinterpret_cast<const char *>(pos + length),
+                            .end     = reinterpret_cast<const char *>(str + 2),
+                        };
+                        return;
+                    }
+                }
+            }
+
+            const uint8_t *end_{};
+            structure_t    current_{};
+        };
+
+        table_view() = default;
+
+        explicit table_view(std::span<const uint8_t> blob)
+            : blob_(blob)
+        {}
+
+        iterator begin() const { return { blob_.data(), blob_.data() + blob_.size() }; }
+
+        iterator end() const { return {}; }
+
+    private:
+        std::span<const uint8_t> blob_{};
+    };
+
     // System Management BIOS
     struct smbios_t
     {
         version_t            version{};
         std::vector<uint8_t> data{};
         std::vector<item_t>  table{};
+
+        // the structures of the data, without copying
+        table_view view() const { return table_view{ data }; }
     };
 
     PROBE_API smbios_t smbios();
 
+    // the structure table only, read once without the version and the item table, for table_view
+    PROBE_API std::vector<uint8_t> structure_table();
+
+#ifdef __linux__
+    // reads the DMI table and the entry point of a dump, e.g. /sys/firmware/dmi/tables/{DMI,smbios_entry_point}
+    // the version is left zero if the entry point can not be read
+    PROBE_API smbios_t smbios(const std::string& dmi, const std::string& entry_point);
+#endif
+
 #pragma pack(push, 1)
 
     struct PhysicalMemoryArray
@@ -1,6 +1,7 @@
 #ifndef PROBE_THREAD_H
 #define PROBE_THREAD_H
 
+#include "probe/cpu.h"
 #include "probe/dllport.h"
 
 #include <cstdint>
@@ -17,6 +18,15 @@ namespace probe::thread
 
     // get name of the current thread
     PROBE_API std::string name();
+
+#ifdef __linux__
+    // pins the calling thread to the processors, pthread_setaffinity_np(3)
+    // return 0 on success, or the error number
+    PROBE_API int set_affinity(const cpu::cpuset_t&);
+
+    // the processors the calling thread is allowed to run on
+    PROBE_API cpu::cpuset_t affinity();
+#endif
 } // namespace probe::thread
 
 #endif //! PROBE_THREAD_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace probe
 {
@@ -61,8 +62,13 @@ namespace probe
     PROBE_API inline vendor_t vendor_cast(uint32_t id) { return static_cast<vendor_t>(id); }
 
     // guess what vendor_t the string is
+    //  - "GenuineIntel" as a whole word is Intel
+    //  - otherwise, the vendor whose name is case-insensitively equal to the string
     PROBE_API vendor_t vendor_cast(const std::string&);
 
+    // all vendors whose name case-insensitively starts with the string, sorted by the names
+    PROBE_API std::vector<vendor_t> vendors_by_prefix(const std::string&);
+
     PROBE_API std::string product_name(uint32_t, uint32_t);
 
     // TODO: bus / protocol ...
@@ -4,7 +4,9 @@
 #include <algorithm>
 #include <atomic>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -117,6 +119,15 @@ namespace probe::util
     PROBE_API void exec_sync(const std::vector<const char *>&,
                              const std::function<bool(const std::string&)>&);
 
+    // reads the file, opened by openat(2) relative to the directory descriptor, into the caller-owned
+    // buffer by a single read(2). for the small files of procfs and sysfs
+    // return the content, or an empty view if failed. the content is truncated to the size of the buffer
+    PROBE_API std::string_view read_at(int, const char *, std::span<char>);
+
+    // as above, but a read that fills the buffer is retried with the string, grown until the content fits.
+    // the string is not touched if the buffer is large enough
+    PROBE_API std::string_view read_at(int, const char *, std::span<char>, std::string&);
+
     class PipeListener : public Listener
     {
     public:
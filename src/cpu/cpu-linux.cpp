@@ -5,63 +5,136 @@
 #include "probe/util.h"
 
 #include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <cpuid.h>
 #include <cstring>
-#include <filesystem>
-#include <fstream>
-#include <optional>
-#include <regex>
+#include <fcntl.h>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <sys/utsname.h>
-#include <unordered_set>
+#include <unistd.h>
 
 namespace probe::cpu
 {
-    static std::optional<std::string> cpuinfo_read_first_of(const char *key)
+    // /proc/cpuinfo, read once and parsed by a single pass into per-processor columns,
+    // the views refer to the text, so it can be neither copied nor moved
+    struct cpuinfo_t
     {
-        std::ifstream cpuinfo("/proc/cpuinfo");
+        cpuinfo_t();
+        cpuinfo_t(const cpuinfo_t&)            = delete;
+        cpuinfo_t& operator=(const cpuinfo_t&) = delete;
 
-        if (!cpuinfo.is_open() || !cpuinfo) return std::nullopt;
+        [[nodiscard]] size_t size() const { return vendor_id.size(); }
 
-        for (std::string line; std::getline(cpuinfo, line);) {
-            if (line.find(key) == 0) {
-                const auto nonspace_id = line.find_first_not_of(" \t", line.find_first_of(':') + 1);
-                return line.c_str() + nonspace_id;
+        std::string text{};
+
+        std::vector<std::string_view> vendor_id{};
+        std::vector<std::string_view> model_name{};
+        std::vector<std::string_view> cpu_mhz{};
+        std::vector<std::string_view> physical_id{};
+        std::vector<std::string_view> core_id{};
+    };
+
+    cpuinfo_t::cpuinfo_t()
+    {
+        // the size of the file is unknown before reading
+        const int fd = ::open("/proc/cpuinfo", O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return;
+        defer(::close(fd));
+
+        for (size_t size = 0;;) {
+            text.resize(size + 65'536);
+            const auto n = ::read(fd, text.data() + size, text.size() - size);
+            if (n <= 0) {
+                text.resize(size);
+                break;
             }
+            size += static_cast<size_t>(n);
         }
 
-        return std::nullopt;
+        std::string_view str{ text };
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            const auto line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
+
+            // <key>\t*: <value>
+            const auto colon = line.find(':');
+            if (colon == std::string_view::npos) continue;
+
+            const auto key   = line.substr(0, line.find_last_not_of(" \t", colon - 1) + 1);
+            const auto vpos  = line.find_first_not_of(" \t", colon + 1);
+            const auto value = vpos == std::string_view::npos ? std::string_view{} : line.substr(vpos);
+
+            // a new row for each processor
+            if (key == "processor") {
+                vendor_id.emplace_back();
+                model_name.emplace_back();
+                cpu_mhz.emplace_back();
+                physical_id.emplace_back();
+                core_id.emplace_back();
+                continue;
+            }
+
+            if (vendor_id.empty()) continue;
+
+            if (key == "vendor_id")
+                vendor_id.back() = value;
+            else if (key == "model name")
+                model_name.back() = value;
+            else if (key == "cpu MHz")
+                cpu_mhz.back() = value;
+            else if (key == "physical id")
+                physical_id.back() = value;
+            else if (key == "core id")
+                core_id.back() = value;
+        }
     }
 
-    static uint32_t cpuinfo_count_of(const char *key)
+    static uint64_t frequency(const cpuinfo_t& cpuinfo)
     {
-        std::ifstream cpuinfo("/proc/cpuinfo");
+        if (!cpuinfo.size()) return 0;
 
-        if (!cpuinfo.is_open() || !cpuinfo) return 0;
+        double     mhz = 0;
+        const auto str = cpuinfo.cpu_mhz.front();
+        std::from_chars(str.data(), str.data() + str.size(), mhz);
+        return static_cast<uint64_t>(mhz * 1'000'000);
+    }
 
-        uint32_t counter = 0;
-        for (std::string line; std::getline(cpuinfo, line);) {
-            if (line.find(key) == 0) {
-                counter++;
-            }
+    // the physical id and core id may be absent, e.g. on ARM
+    static quantities_t quantities(const cpuinfo_t& cpuinfo)
+    {
+        std::vector<std::string_view>                              packages{};
+        std::vector<std::pair<std::string_view, std::string_view>> cores{};
+        for (size_t i = 0; i < cpuinfo.size(); ++i) {
+            packages.emplace_back(cpuinfo.physical_id[i]);
+            cores.emplace_back(cpuinfo.physical_id[i], cpuinfo.core_id[i]);
         }
-        return counter;
+        probe::util::unique(packages);
+        probe::util::unique(cores);
+
+        const auto unknown = cpuinfo.size() && cpuinfo.core_id.front().empty();
+
+        cpu::quantities_t ret{};
+
+        ret.logical  = static_cast<uint32_t>(cpuinfo.size());
+        ret.packages = static_cast<uint32_t>(packages.size());
+        ret.physical = unknown ? ret.logical : static_cast<uint32_t>(cores.size());
+
+        return ret;
     }
 
-    static uint32_t cpuinfo_unique_count_of(const char *key)
+    static vendor_t vendor(const cpuinfo_t& cpuinfo)
     {
-        std::ifstream cpuinfo("/proc/cpuinfo");
-
-        if (!cpuinfo.is_open() || !cpuinfo) return 0;
+        return vendor_cast(cpuinfo.size() ? std::string{ cpuinfo.vendor_id.front() } : std::string{});
+    }
 
-        std::unordered_set<std::string> values{};
-        for (std::string line; std::getline(cpuinfo, line);) {
-            if (line.find(key) == 0) {
-                const auto nonspace_id = line.find_first_not_of(" \t", line.find_first_of(':') + 1);
-                values.insert(line.c_str() + nonspace_id);
-            }
-        }
-        return values.size();
+    static std::string name(const cpuinfo_t& cpuinfo)
+    {
+        return cpuinfo.size() ? std::string{ cpuinfo.model_name.front() } : std::string{};
     }
 
     architecture_t architecture()
@@ -81,113 +154,366 @@ namespace probe::cpu
             return cpu::architecture_t::unknown;
     }
 
-    uint64_t frequency()
+    uint64_t frequency() { return frequency(cpuinfo_t{}); }
+
+    static int32_t sysfs_int(int dirfd, const char *path, std::span<char> buffer)
     {
-        return static_cast<uint64_t>(
-            std::strtod(cpuinfo_read_first_of("cpu MHz").value_or("0").c_str(), nullptr) * 1'000'000);
+        const auto str = probe::util::read_at(dirfd, path, buffer);
+
+        int32_t value = -1;
+        std::from_chars(str.data(), str.data() + str.size(), value);
+        return value;
     }
 
-    // https://stackoverflow.com/questions/150355/programmatically-find-the-number-of-cores-on-a-machine
-    quantities_t quantities()
+    cpuset_t read_cpuset(int dirfd, const char *path, std::span<char> buffer)
     {
-        cpu::quantities_t ret{};
+        auto str = probe::util::read_at(dirfd, path, buffer);
+        while (!str.empty() && (str.back() == '\n' || str.back() == ' ')) str.remove_suffix(1);
+        return to_cpuset(str);
+    }
+
+    // NUMA node of the processors, /sys/devices/system/node/node<N>/cpulist
+    static void topology_nodes(std::vector<processor_t>& processors, std::span<char> buffer)
+    {
+        const int nodefd = ::open("/sys/devices/system/node", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (nodefd < 0) return;
+        defer(::close(nodefd));
 
-        ret.logical  = cpuinfo_count_of("processor");
-        ret.packages = cpuinfo_unique_count_of("physical id");
-        ret.physical = ret.logical / ret.packages;
+        char path[64];
+        for (const auto node : read_cpuset(nodefd, "online", buffer).cpus()) {
+            ::snprintf(path, sizeof(path), "node%zu/cpulist", node);
 
-        return ret;
+            for (const auto cpu : read_cpuset(nodefd, path, buffer).cpus()) {
+                const auto it = std::ranges::lower_bound(processors, cpu, {}, &processor_t::id);
+                if (it != processors.end() && it->id == cpu) it->node = static_cast<int32_t>(node);
+            }
+        }
     }
 
-    static std::optional<unsigned long> file_read_lu(const std::filesystem::path& path)
+    static topology_t read_topology()
     {
-        auto          fd = ::fopen(path.c_str(), "r");
-        unsigned long value;
+        topology_t ret{};
+
+        const int cpufd = ::open("/sys/devices/system/cpu", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (cpufd < 0) return ret;
+        defer(::close(cpufd));
+
+        char buffer[4'096];
+        char path[64];
+
+        ret.online = read_cpuset(cpufd, "online", buffer);
+
+        for (const auto id : read_cpuset(cpufd, "present", buffer).cpus()) {
+            // the topology directory is removed while the processor is offline
+            const auto topology = [&](const char *name) {
+                ::snprintf(path, sizeof(path), "cpu%zu/topology/%s", id, name);
+                return path;
+            };
+
+            auto& processor = ret.processors.emplace_back(processor_t{
+                .id       = static_cast<uint32_t>(id),
+                .package  = sysfs_int(cpufd, topology("physical_package_id"), buffer),
+                .die      = sysfs_int(cpufd, topology("die_id"), buffer),
+                .cluster  = sysfs_int(cpufd, topology("cluster_id"), buffer),
+                .core     = sysfs_int(cpufd, topology("core_id"), buffer),
+                .online   = ret.online.test(id),
+                .siblings = read_cpuset(cpufd, topology("thread_siblings_list"), buffer),
+            });
+
+            if (processor.siblings.empty()) processor.siblings.set(id);
+            if (!processor.online) ret.offline.set(id);
+        }
+
+        topology_nodes(ret.processors, buffer);
+
+        // counted over the online processors
+        std::vector<int32_t>                     packages{};
+        std::vector<std::pair<int32_t, int32_t>> dies{};
+        std::vector<int32_t>                     nodes{};
 
-        if (fd) {
-            defer(::fclose(fd));
+        for (const auto& processor : ret.processors) {
+            if (!processor.online) continue;
 
-            if (1 == ::fscanf(fd, "%lu", &value)) {
-                return value;
+            ret.threads++;
+
+            packages.emplace_back(std::max(processor.package, 0));
+            dies.emplace_back(std::max(processor.package, 0), std::max(processor.die, 0));
+            if (processor.node >= 0) nodes.emplace_back(processor.node);
+
+            // a core is counted by its first online sibling
+            size_t siblings = 0;
+            bool   first    = true;
+            for (const auto cpu : processor.siblings.cpus()) {
+                if (!ret.online.test(cpu)) continue;
+
+                siblings++;
+                if (cpu < processor.id) first = false;
             }
+
+            if (first) ret.cores++;
+            ret.smt = std::max<uint32_t>(ret.smt, static_cast<uint32_t>(siblings));
         }
-        return std::nullopt;
+
+        probe::util::unique(packages);
+        probe::util::unique(dies);
+        probe::util::unique(nodes);
+
+        ret.packages = static_cast<uint32_t>(packages.size());
+        ret.dies     = static_cast<uint32_t>(dies.size());
+        ret.nodes    = static_cast<uint32_t>(nodes.size());
+
+        return ret;
     }
 
-    static std::string file_read(const std::string& file)
+    std::shared_ptr<const topology_t> topology(bool refresh)
     {
-        std::ifstream ifs(file);
+        // the snapshot is immutable, a refresh swaps in a new one and the holders of the old one keep it
+        static std::atomic<std::shared_ptr<const topology_t>> cached{};
 
-        if (!ifs) return {};
+        auto snapshot = cached.load();
+        if (!snapshot || refresh) {
+            snapshot = std::make_shared<const topology_t>(read_topology());
+            cached.store(snapshot);
+        }
+        return snapshot;
+    }
 
-        std::stringstream buffer;
-        buffer << ifs.rdbuf();
+    // https://stackoverflow.com/questions/150355/programmatically-find-the-number-of-cores-on-a-machine
+    static quantities_t quantities(const topology_t& topology)
+    {
+        return {
+            .logical  = topology.threads,
+            .physical = topology.cores,
+            .packages = topology.packages,
+        };
+    }
 
-        return buffer.str();
+    sampler::sampler()
+        : stat_(::open("/proc/stat", O_RDONLY | O_CLOEXEC))
+    {
+        const auto count = std::max<long>(::sysconf(_SC_NPROCESSORS_CONF), 1);
+
+        // "cpuN" + 10 columns of up to 20 digits, and the aggregate line
+        buffer_.resize((count + 1) * 256 + 4'096);
+        freqs_.resize(count, -2);
+        prev_.resize(count);
+        curr_.resize(count);
+        usages_.reserve(count);
     }
 
-    // /sys/devices/system/cpu/cpu<N>/cache/index<M>/<F>
-    std::vector<cache_t> caches()
+    sampler::~sampler()
+    {
+        for (const auto fd : freqs_) {
+            if (fd >= 0) ::close(fd);
+        }
+        if (stat_ >= 0) ::close(stat_);
+    }
+
+    // "cpu0 4705 356 584 3699 23 23 0 0 0 0\n"
+    static const char *parse_cpu_line(const char *ptr, const char *end, uint64_t (&columns)[8])
     {
-        // cpus
-        std::vector<std::filesystem::path> cpus{};
-        for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/cpu")) {
-            auto dirname = entry.path().filename().string();
-            if (std::regex_search(dirname, std::regex("\\bcpu[\\d]+"))) cpus.emplace_back(entry);
+        for (auto& column : columns) {
+            while (ptr < end && *ptr == ' ') ptr++;
+
+            column = 0;
+            ptr    = std::from_chars(ptr, end, column).ptr;
+        }
+
+        return ptr;
+    }
+
+    const std::vector<core_usage_t>& sampler::sample()
+    {
+        usages_.clear();
+        if (stat_ < 0) return usages_;
+
+        // the cpu lines come first, the buffer is grown until the line following them is read
+        std::string_view text{};
+        while (true) {
+            const auto size = ::pread(stat_, buffer_.data(), buffer_.size(), 0);
+            if (size <= 0) return usages_;
+
+            text = { buffer_.data(), static_cast<size_t>(size) };
+            if (static_cast<size_t>(size) < buffer_.size() || text.find("\nintr") != std::string_view::npos)
+                break;
+
+            buffer_.resize(buffer_.size() * 2);
         }
 
-        std::map<std::string, cache_t> caches;
-
-        for (const auto& cpu : cpus) {
-            for (size_t idx = 0; idx < 8; ++idx) {
-
-                std::string subdir = "cache/index" + std::to_string(idx);
-
-                if (std::filesystem::exists(cpu / subdir)) {
-                    auto level = file_read_lu(cpu / subdir / "level");
-                    if (!level.has_value()) continue;
-
-                    auto size_str = file_read(cpu / subdir / "size");
-                    if (size_str.empty()) continue;
-                    auto size = std::stoul(size_str);
-                    auto upos = size_str.find_first_not_of("0123456789 ");
-                    if (upos != std::string::npos) {
-                        if (size_str[upos] == 'K') size *= 1'024;
-                        if (size_str[upos] == 'M') size *= 1'024 * 1'024;
-                        if (size_str[upos] == 'G') size *= 1'024 * 1'024 * 1'024;
-                    }
-
-                    auto line_size = file_read_lu(cpu / subdir / "coherency_line_size");
-                    if (!line_size.has_value()) continue;
-
-                    auto associativity = file_read_lu(cpu / subdir / "ways_of_associativity");
-                    if (!associativity.has_value()) continue;
-
-                    auto id = file_read_lu(cpu / subdir / "id");
-                    if (!id.has_value()) continue;
-
-                    // type
-                    auto type_str = probe::util::trim(file_read(cpu / subdir / "type"));
-                    if (type_str.empty()) continue;
-                    auto type = to_cache_type(type_str);
-
-                    caches[type_str + std::to_string(((level.value() << 8) | id.value()))] = cache_t{
-                        .level         = static_cast<int32_t>(level.value()),
-                        .associativity = static_cast<int32_t>(associativity.value()),
-                        .line_size     = line_size.value(),
-                        .size          = size,
-                        .type          = type,
-                    };
-                }
+        for (auto& ticks : curr_) ticks.valid = false;
+
+        const char *ptr = text.data();
+        const char *end = text.data() + text.size();
+        while (ptr + 4 < end && ptr[0] == 'c' && ptr[1] == 'p' && ptr[2] == 'u') {
+            ptr += 3;
+
+            // skips the aggregate line
+            uint32_t id{};
+            const auto [next, ec] = std::from_chars(ptr, end, id);
+            const bool aggregate  = ec != std::errc{};
+
+            uint64_t columns[8]{}; // user nice system idle iowait irq softirq steal
+            ptr = parse_cpu_line(next, end, columns);
+            ptr = std::find(ptr, end, '\n');
+            if (ptr != end) ptr++;
+
+            if (aggregate) continue;
+
+            if (id >= curr_.size()) {
+                curr_.resize(id + 1);
+                prev_.resize(id + 1);
+                freqs_.resize(id + 1, -2);
             }
+
+            const auto [user, nice, system, idle, iowait, irq, softirq, steal] = columns;
+
+            curr_[id] = ticks_t{
+                .valid  = true,
+                .busy   = user + nice + system + irq + softirq + steal,
+                .user   = user + nice,
+                .system = system,
+                .idle   = idle,
+                .iowait = iowait,
+                .irq    = irq + softirq,
+                .steal  = steal,
+            };
+        }
+
+        char path[96];
+        char freq[32];
+        for (uint32_t id = 0; id < curr_.size(); ++id) {
+            const auto& curr = curr_[id];
+            const auto& prev = prev_[id];
+            if (!curr.valid || !prev.valid) continue;
+
+            // iowait may go backwards, and idle across the hotplug, the deltas are clamped to 0
+            const auto delta = [](uint64_t now, uint64_t before) -> uint64_t {
+                return now > before ? now - before : 0;
+            };
+
+            const auto total = static_cast<double>(delta(curr.busy, prev.busy) +
+                                                   delta(curr.idle, prev.idle) +
+                                                   delta(curr.iowait, prev.iowait));
+            const auto ratio = [&](uint64_t now, uint64_t before) {
+                return total > 0 ? static_cast<double>(delta(now, before)) / total * 100 : 0.0;
+            };
+
+            if (freqs_[id] == -2) {
+                ::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/scaling_cur_freq", id);
+                freqs_[id] = ::open(path, O_RDONLY | O_CLOEXEC);
+            }
+
+            uint64_t khz{};
+            if (freqs_[id] >= 0) {
+                const auto size = ::pread(freqs_[id], freq, sizeof(freq), 0);
+                if (size > 0) std::from_chars(freq, freq + size, khz);
+            }
+
+            usages_.emplace_back(core_usage_t{
+                .id        = id,
+                .usage     = ratio(curr.busy, prev.busy),
+                .user      = ratio(curr.user, prev.user),
+                .system    = ratio(curr.system, prev.system),
+                .iowait    = ratio(curr.iowait, prev.iowait),
+                .irq       = ratio(curr.irq, prev.irq),
+                .steal     = ratio(curr.steal, prev.steal),
+                .frequency = khz * 1'000,
+            });
+        }
+
+        prev_.swap(curr_);
+
+        return usages_;
+    }
+
+    // sysfs is not available in some containers, falls back to /proc/cpuinfo
+    quantities_t quantities()
+    {
+        const auto topo = topology();
+        return topo->threads ? quantities(*topo) : quantities(cpuinfo_t{});
+    }
+
+    // "32K", "1024K", "8M"
+    static uint64_t cache_size(std::string_view str)
+    {
+        uint64_t size{};
+        const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), size);
+        if (ec != std::errc{} || ptr == str.data() + str.size()) return size;
+
+        switch (*ptr) {
+        case 'K': return size * 1'024;
+        case 'M': return size * 1'024 * 1'024;
+        case 'G': return size * 1'024 * 1'024 * 1'024;
+        default:  return size;
         }
+    }
+
+    // "Data", "Instruction", "Unified"
+    static cache_type_t cache_type(std::string_view str)
+    {
+        if (str.starts_with("Data")) return cache_type_t::data;
+        if (str.starts_with("Instruction")) return cache_type_t::instruction;
+        if (str.starts_with("Trace")) return cache_type_t::trace;
+        return cache_type_t::unified;
+    }
+
+    // /sys/devices/system/cpu/cpu<N>/cache/index<M>/<F>
+    // a cache is read once, by the first processor of its shared_cpu_list, the other processors sharing
+    // it only read the list
+    std::vector<cache_t> caches()
+    {
+        std::vector<cache_t> ret{};
+
+        const int cpufd = ::open("/sys/devices/system/cpu", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (cpufd < 0) return ret;
+        defer(::close(cpufd));
 
-        std::vector<cache_t> ret;
+        // shared_cpu_list of a large system may be long, e.g. "0,2,4,...", sized like the other cpu lists
+        char buffer[4'096];
+        char path[96];
 
-        for (const auto& [k, v] : caches) {
-            ret.emplace_back(v);
+        const auto present = read_cpuset(cpufd, "present", buffer);
+
+        for (const auto cpu : present.cpus()) {
+            for (size_t idx = 0;; ++idx) {
+                const auto file = [&](const char *name) {
+                    ::snprintf(path, sizeof(path), "cpu%zu/cache/index%zu/%s", cpu, idx, name);
+                    return path;
+                };
+
+                const auto level = sysfs_int(cpufd, file("level"), buffer);
+                if (level < 0) break;
+
+                auto shared = read_cpuset(cpufd, file("shared_cpu_list"), buffer);
+                if (shared.empty()) shared.set(cpu);
+
+                // owned by a processor scanned before
+                const auto owner = shared.cpus().front();
+                if (owner < cpu && present.test(owner)) continue;
+
+                char       type[32];
+                const auto type_str = probe::util::read_at(cpufd, file("type"), type);
+                if (type_str.empty()) continue;
+
+                const auto size = cache_size(probe::util::read_at(cpufd, file("size"), buffer));
+                if (size == 0) continue;
+
+                const auto ways      = sysfs_int(cpufd, file("ways_of_associativity"), buffer);
+                const auto line_size = sysfs_int(cpufd, file("coherency_line_size"), buffer);
+
+                ret.emplace_back(cache_t{
+                    .level         = level,
+                    .associativity = std::max(ways, 0),
+                    .line_size     = static_cast<uint64_t>(std::max(line_size, 0)),
+                    .size          = size,
+                    .type          = cache_type(type_str),
+                    .shared        = std::move(shared),
+                });
+            }
         }
 
+        std::ranges::stable_sort(ret, {}, &cache_t::level);
+
         return ret;
     }
 
@@ -205,19 +531,29 @@ namespace probe::cpu
         return ret;
     }
 
-    vendor_t vendor() { return vendor_cast(cpuinfo_read_first_of("vendor").value_or("")); }
+    vendor_t vendor() { return vendor(cpuinfo_t{}); }
 
-    std::string name() { return cpuinfo_read_first_of("model name").value_or(""); }
+    std::string name() { return name(cpuinfo_t{}); }
 
     cpu_info_t info()
     {
-        return { name(), vendor(), architecture(), endianness(), frequency(), quantities() };
+        const cpuinfo_t cpuinfo{};
+        const auto      topo = topology();
+        return { name(cpuinfo), vendor(cpuinfo), architecture(), endianness(), frequency(cpuinfo),
+                 topo->threads ? quantities(*topo) : quantities(cpuinfo) };
     }
 
     void cpuid(int32_t (&info)[4], int32_t leaf, int32_t subleaf)
     {
         __cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
     }
+
+    uint64_t xgetbv(uint32_t index)
+    {
+        uint32_t eax{}, edx{};
+        __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+    }
 } // namespace probe::cpu
 
 #endif // __linux__
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "probe/util.h"
 
 #include <bitset>
+#include <immintrin.h>
 #include <vector>
 #include <Windows.h>
 
@@ -24,6 +25,24 @@ namespace probe::cpu
         return processors;
     }
 
+    // the processors of the current processor group
+    static cpuset_t mask_cpuset(ULONG_PTR mask)
+    {
+        return cpuset_t{ .words = { static_cast<uint64_t>(mask) } };
+    }
+
+    static cache_t make_cache(const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& info)
+    {
+        return cache_t{
+            .level         = info.Cache.Level,
+            .associativity = info.Cache.Associativity,
+            .line_size     = info.Cache.LineSize,
+            .size          = info.Cache.Size,
+            .type          = static_cast<cache_type_t>(info.Cache.Type),
+            .shared        = mask_cpuset(info.ProcessorMask),
+        };
+    }
+
     architecture_t architecture()
     {
         SYSTEM_INFO system_info;
@@ -81,8 +100,7 @@ namespace probe::cpu
 
         for (const auto& info : processor_info()) {
             if (info.Relationship == RelationCache) {
-                ret.emplace_back(info.Cache.Level, info.Cache.Associativity, info.Cache.LineSize,
-                                 info.Cache.Size, static_cast<cache_type_t>(info.Cache.Type));
+                ret.emplace_back(make_cache(info));
             }
         }
         return ret;
@@ -95,8 +113,7 @@ namespace probe::cpu
         for (const auto& info : processor_info()) {
             if ((info.Relationship == RelationCache) && (info.Cache.Level == level) &&
                 (info.Cache.Type == static_cast<PROCESSOR_CACHE_TYPE>(type))) {
-                ret.emplace_back(info.Cache.Level, info.Cache.Associativity, info.Cache.LineSize,
-                                 info.Cache.Size, static_cast<cache_type_t>(info.Cache.Type));
+                ret.emplace_back(make_cache(info));
             }
         }
         return ret;
@@ -136,6 +153,8 @@ namespace probe::cpu
     //  allowed, set function_id to 0x80000000. The maximum value of function_id supported for extended
     //  functions will be written to cpuInfo[0].
     void cpuid(int32_t (&info)[4], int32_t leaf, int32_t subleaf) { __cpuidex(info, leaf, subleaf); }
+
+    uint64_t xgetbv(uint32_t index) { return _xgetbv(index); }
 } // namespace probe::cpu
 
 #endif // _WIN32
\ No newline at end of file
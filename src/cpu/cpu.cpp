@@ -3,6 +3,7 @@
 #include "probe/types.h"
 
 #include <bitset>
+#include <charconv>
 #include <regex>
 
 namespace probe::cpu
@@ -15,6 +16,51 @@ namespace probe::cpu
         return (result == 0xFF) ? endianness_t::big : endianness_t::little;
     }
 
+    std::vector<size_t> cpuset_t::cpus() const
+    {
+        std::vector<size_t> ret{};
+        for (size_t i = 0; i < words.size(); ++i) {
+            for (auto word = words[i]; word; word &= word - 1) {
+                ret.emplace_back(i * 64 + std::countr_zero(word));
+            }
+        }
+        return ret;
+    }
+
+    bool cpuset_t::operator==(const cpuset_t& other) const
+    {
+        const auto n    = std::min(words.size(), other.words.size());
+        const auto zero = [](auto word) { return word == 0; };
+
+        return std::equal(words.begin(), words.begin() + n, other.words.begin()) &&
+               std::all_of(words.begin() + n, words.end(), zero) &&
+               std::all_of(other.words.begin() + n, other.words.end(), zero);
+    }
+
+    cpuset_t to_cpuset(std::string_view str)
+    {
+        cpuset_t ret{};
+
+        while (!str.empty()) {
+            const auto comma = str.find(',');
+            const auto range = str.substr(0, comma);
+            str.remove_prefix(comma == std::string_view::npos ? str.size() : comma + 1);
+
+            size_t first = 0, last = 0;
+            auto [ptr, ec] = std::from_chars(range.data(), range.data() + range.size(), first);
+            if (ec != std::errc{}) continue;
+
+            last = first;
+            if (ptr < range.data() + range.size() && *ptr == '-') {
+                if (std::from_chars(ptr + 1, range.data() + range.size(), last).ec != std::errc{}) continue;
+            }
+
+            for (auto cpu = first; cpu <= last; ++cpu) ret.set(cpu);
+        }
+
+        return ret;
+    }
+
     cache_type_t to_cache_type(const std::string& str)
     {
         if (std::regex_search(str, std::regex("\\bunified", std::regex_constants::icase)))
@@ -47,8 +93,77 @@ namespace probe::cpu
 
 #undef FEATURE_BIT_MASK
 
+    // the listed registers of the supported leaves, the others are left zero
+    static feature_set_t read_features()
+    {
+        feature_set_t set{};
+        int32_t       info[4]{};
+
+        cpuid(info, 0, 0);
+        const auto ids = static_cast<uint32_t>(info[0]);
+
+        cpuid(info, 0x8000'0000, 0);
+        const auto exids = static_cast<uint32_t>(info[0]);
+
+        for (size_t i = 0; i < std::size(feature_registers); ++i) {
+            const auto& reg = feature_registers[i];
+            if (reg.leaf > (reg.leaf >= 0x8000'0000 ? exids : ids)) continue;
+
+            cpuid(info, static_cast<int32_t>(reg.leaf), static_cast<int32_t>(reg.subleaf));
+            set.words[i] = static_cast<uint32_t>(info[reg.reg]);
+        }
+
+        // the instructions are usable only if the OS saves their registers on context switches
+        const auto xcr0 = set.has(feature_t::osxsave) ? xgetbv(0) : 0;
+        const auto drop = [&](const feature_set_t& features) {
+            for (size_t i = 0; i < std::size(set.words); ++i) set.words[i] &= ~features.words[i];
+        };
+
+        // SSE | AVX(YMM)
+        if ((xcr0 & 0x06) != 0x06) {
+            drop({
+                feature_t::avx, feature_t::avx2, feature_t::fma, feature_t::fma4, feature_t::xop,
+                feature_t::f16c, feature_t::vaes, feature_t::vpclmulqdq, feature_t::avx_vnni,
+                feature_t::avx_ifma, feature_t::avx_vnn_int8, feature_t::avx_ne_convert,
+            });
+        }
+
+        // LWP, its state is saved by XSAVE as well
+        if (!(xcr0 & (uint64_t{ 1 } << 62))) drop({ feature_t::lwp });
+
+        // SSE | AVX(YMM) | opmask | ZMM_Hi256 | Hi16_ZMM
+        if ((xcr0 & 0xe6) != 0xe6) {
+            drop({
+                feature_t::avx512_f, feature_t::avx512_dq, feature_t::avx512_ifma, feature_t::avx512_pf,
+                feature_t::avx512_er, feature_t::avx512_cd, feature_t::avx512_bw, feature_t::avx512_vl,
+                feature_t::avx512_vbmi, feature_t::avx512_vbmi2, feature_t::avx512_vnni,
+                feature_t::avx512_bitalg, feature_t::avx512_vpopcntdq, feature_t::avx512_4vnniw,
+                feature_t::avx512_4fmaps, feature_t::avx512_vp2intersect, feature_t::avx512_fp16,
+                feature_t::avx512_bf16,
+            });
+        }
+
+        // XTILECFG | XTILEDATA
+        if ((xcr0 & 0x6'0000) != 0x6'0000) {
+            drop({
+                feature_t::amx_bf16, feature_t::amx_tile, feature_t::amx_int8, feature_t::amx_fp16,
+                feature_t::amx_complex,
+            });
+        }
+
+        return set;
+    }
+
+    const feature_set_t& features()
+    {
+        static const feature_set_t set = read_features();
+        return set;
+    }
+
     bool is_supported(feature_t feature)
     {
+        if (feature_index(feature) >= 0) return features().has(feature);
+
         int32_t info[4]{};
 
         cpuid(info, 0, 0);
@@ -65,8 +180,18 @@ namespace probe::cpu
 
     // https://en.wikipedia.org/wiki/CPUID
     // https://learn.microsoft.com/en-us/cpp/intrinsics/cpuid-cpuidex?view=msvc-170
-    std::vector<feature_t> instruction_sets()
+    static std::vector<feature_t> read_instruction_sets()
     {
+        // the registers are looked up in the snapshot instead of executing cpuid again
+        const auto& features = cpu::features();
+        const auto  word     = [&](uint32_t leaf, uint32_t subleaf, uint32_t reg) {
+            for (size_t i = 0; i < std::size(feature_registers); ++i) {
+                const auto& r = feature_registers[i];
+                if (r.leaf == leaf && r.subleaf == subleaf && r.reg == reg) return features.words[i];
+            }
+            return uint32_t{};
+        };
+
         int32_t info[4]{};
 
         // Calling __cpuid with 0x0 as the function_id argument gets the number of the highest valid
@@ -85,10 +210,8 @@ namespace probe::cpu
         vendor_t vendor = vendor_cast(vendor_name);
 
         if (ids >= 1) {
-            cpuid(info, 1, 0);
-
-            std::bitset<32> ecx = info[2];
-            std::bitset<32> edx = info[3];
+            std::bitset<32> ecx = word(0x0000'0001, 0, 2);
+            std::bitset<32> edx = word(0x0000'0001, 0, 3);
 
             if (ecx[0]) isets.push_back(feature_t::sse3);
             if (ecx[1]) isets.push_back(feature_t::pclmulqdq);
@@ -119,10 +242,8 @@ namespace probe::cpu
         }
 
         if (ids >= 7) {
-            cpuid(info, 7, 0);
-
-            std::bitset<32> ebx = info[1];
-            std::bitset<32> ecx = info[2];
+            std::bitset<32> ebx = word(0x0000'0007, 0, 1);
+            std::bitset<32> ecx = word(0x0000'0007, 0, 2);
 
             if (ebx[0]) isets.push_back(feature_t::fsgsbase);
             if (ebx[3]) isets.push_back(feature_t::bmi1);
@@ -155,10 +276,8 @@ namespace probe::cpu
         int32_t exids = info[0];
 
         if (exids >= static_cast<int32_t>(0x8000'0001)) {
-            cpuid(info, 0x8000'0001, 0);
-
-            std::bitset<32> ecx = info[2];
-            std::bitset<32> edx = info[3];
+            std::bitset<32> ecx = word(0x8000'0001, 0, 2);
+            std::bitset<32> edx = word(0x8000'0001, 0, 3);
 
             if (ecx[5] && vendor == vendor_t::Intel) isets.push_back(feature_t::lzcnt); // intel
             if (ecx[5] && vendor == vendor_t::AMD) isets.push_back(feature_t::abm);     // amd
@@ -175,6 +294,12 @@ namespace probe::cpu
 
         return isets;
     }
+
+    std::vector<feature_t> instruction_sets()
+    {
+        static const std::vector<feature_t> isets = read_instruction_sets();
+        return isets;
+    }
 } // namespace probe::cpu
 
 namespace probe
@@ -201,6 +326,26 @@ namespace probe
         }
     }
 
+    std::string to_string(const cpu::cpuset_t& set)
+    {
+        std::string str{};
+
+        const auto cpus = set.cpus();
+        for (size_t i = 0; i < cpus.size();) {
+            // [first, last]
+            auto j = i;
+            while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+
+            if (!str.empty()) str += ',';
+            str += std::to_string(cpus[i]);
+            if (j > i) str += '-' + std::to_string(cpus[j]);
+
+            i = j + 1;
+        }
+
+        return str;
+    }
+
     std::string to_string(cpu::cache_type_t type)
     {
         switch (type) {
@@ -2,24 +2,148 @@
 
 #include "probe/memory.h"
 
+#include "probe/util.h"
+
+#include <algorithm>
+#include <charconv>
+#include <fcntl.h>
+#include <iterator>
 #include <sys/sysinfo.h>
 
 namespace probe::memory
 {
-    memory_status_t status()
+    struct meminfo_key_t
+    {
+        std::string_view           key;
+        uint64_t memory_status_t::*member;
+        uint64_t                   unit; // the values in "kB" are scaled to bytes
+    };
+
+    // sorted by key
+    // clang-format off
+    static constexpr meminfo_key_t meminfo_keys[] = {
+        { "Buffers",         &memory_status_t::buffers,          1'024 },
+        { "Cached",          &memory_status_t::cached,           1'024 },
+        { "Dirty",           &memory_status_t::dirty,            1'024 },
+        { "HugePages_Free",  &memory_status_t::hugepages_free,   1     },
+        { "HugePages_Total", &memory_status_t::hugepages_total,  1     },
+        { "Hugepagesize",    &memory_status_t::hugepage_size,    1'024 },
+        { "MemAvailable",    &memory_status_t::avail,            1'024 },
+        { "MemFree",         &memory_status_t::free,             1'024 },
+        { "MemTotal",        &memory_status_t::total,            1'024 },
+        { "SReclaimable",    &memory_status_t::slab_reclaimable, 1'024 },
+        { "Slab",            &memory_status_t::slab,             1'024 },
+        { "SwapCached",      &memory_status_t::swap_cached,      1'024 },
+        { "SwapFree",        &memory_status_t::swap_free,        1'024 },
+        { "SwapTotal",       &memory_status_t::swap_total,       1'024 },
+        { "Writeback",       &memory_status_t::writeback,        1'024 },
+    };
+    // clang-format on
+
+    static_assert(std::ranges::is_sorted(meminfo_keys, {}, &meminfo_key_t::key));
+
+    // <key>:<spaces><value>[ kB]
+    bool parse_meminfo(std::string_view str, memory_status_t& s)
     {
-        struct sysinfo info{};
-        ::sysinfo(&info);
+        if (str.empty()) return false;
+
+        bool available = false;
+
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            const auto line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
 
-        return {
-            .avail = info.freeram,
-            .total = info.totalram,
-        };
+            const auto pos = line.find(':');
+            if (pos == std::string_view::npos) continue;
+
+            const auto key = line.substr(0, pos);
+            const auto it  = std::ranges::lower_bound(meminfo_keys, key, {}, &meminfo_key_t::key);
+            if (it == std::end(meminfo_keys) || it->key != key) continue;
+
+            auto value = line.substr(pos + 1);
+            value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+
+            uint64_t number{};
+            std::from_chars(value.data(), value.data() + value.size(), number);
+            s.*(it->member) = number * it->unit;
+
+            if (it->member == &memory_status_t::avail) available = true;
+        }
+
+        // MemAvailable is missing before Linux 3.14
+        if (!available) s.avail = s.free + s.buffers + s.cached;
+
+        return true;
     }
 
-    std::vector<MemoryDevice> devices() { return {}; }
+    // some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    // full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    bool parse_pressure(std::string_view str, memory_status_t& s)
+    {
+        if (str.empty()) return false;
+
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            auto       line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
 
-    std::vector<PhysicalMemoryArray> physical_device_arrays() { return {}; }
+            pressure_t *pressure = nullptr;
+            if (line.starts_with("some "))
+                pressure = &s.some;
+            else if (line.starts_with("full "))
+                pressure = &s.full;
+            else
+                continue;
+
+            line.remove_prefix(5);
+
+            // <name>=<value>, separated by spaces
+            while (!line.empty()) {
+                const auto sp    = line.find(' ');
+                const auto field = line.substr(0, sp);
+                line.remove_prefix(sp == std::string_view::npos ? line.size() : sp + 1);
+
+                const auto eq = field.find('=');
+                if (eq == std::string_view::npos) continue;
+
+                const auto name  = field.substr(0, eq);
+                const auto value = field.substr(eq + 1);
+                const auto first = value.data();
+                const auto last  = value.data() + value.size();
+
+                if (name == "avg10")
+                    std::from_chars(first, last, pressure->avg10);
+                else if (name == "avg60")
+                    std::from_chars(first, last, pressure->avg60);
+                else if (name == "avg300")
+                    std::from_chars(first, last, pressure->avg300);
+                else if (name == "total")
+                    std::from_chars(first, last, pressure->total);
+            }
+        }
+
+        return true;
+    }
+
+    // /proc/meminfo and /proc/pressure/memory, read into the stack buffer
+    memory_status_t status()
+    {
+        memory_status_t ret{};
+        char            buffer[8'192];
+
+        if (!parse_meminfo(probe::util::read_at(AT_FDCWD, "/proc/meminfo", buffer), ret)) {
+            struct sysinfo info{};
+            ::sysinfo(&info);
+
+            ret.avail = info.freeram * info.mem_unit;
+            ret.total = info.totalram * info.mem_unit;
+        }
+
+        parse_pressure(probe::util::read_at(AT_FDCWD, "/proc/pressure/memory", buffer), ret);
+
+        return ret;
+    }
 } // namespace probe::memory
 
-#endif
\ No newline at end of file
+#endif
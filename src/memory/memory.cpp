@@ -0,0 +1,118 @@
+#include "probe/memory.h"
+
+namespace probe::memory
+{
+    // Physical Memory Array (Type 16)
+    PhysicalMemoryArray to_physical_memory_array(const smbios::structure_t& structure)
+    {
+        const auto arr = structure.fields<smbios::PhysicalMemoryArray>();
+
+        return {
+            .Handle                = structure.handle,
+            .Location              = arr.Location,
+            .Use                   = arr.Use,
+            .MemoryErrorCorrection = arr.MemoryErrorCorrection,
+            // 0x8000'0000: the capacity is given by the Extended Maximum Capacity, in bytes
+            .Capacity = (arr.MaximumCapacity == 0x8000'0000) ? arr.ExtendedMaximumCapacity / 1'024
+                                                             : arr.MaximumCapacity,
+            .MemoryErrorInfomationHandle = arr.MemoryErrorInfomationHandle,
+            .NumberOfMemoryDevices       = arr.NumberOfMemoryDevices,
+        };
+    }
+
+    // Size: 0 - not installed, 0xffff - unknown, 0x7fff - given by the Extended Size (MB),
+    //       otherwise in KB if the bit 15 is set, or in MB
+    static uint64_t memory_device_size(const smbios::MemoryDevice& dev)
+    {
+        if (dev.Size == 0 || dev.Size == 0xffff) return 0;
+
+        if (dev.Size == 0x7fff) return (dev.ExtendedSize & 0x7fff'ffffull) * 1'024 * 1'024;
+
+        return (dev.Size & 0x8000) ? (dev.Size & 0x7fffull) * 1'024 : dev.Size * 1'024ull * 1'024;
+    }
+
+    // Memory Device (Type 17)
+    MemoryDevice to_memory_device(const smbios::structure_t& structure)
+    {
+        const auto dev = structure.fields<smbios::MemoryDevice>();
+
+        const auto string = [&](uint8_t index) { return std::string{ structure.string(index) }; };
+
+        return {
+            .Handle                            = structure.handle,
+            .PhysicalMemeoryArrayHandle        = dev.PhysicalMemeoryArrayHandle,
+            .MemoryErrorInformationHandle      = dev.MemoryErrorInformationHandle,
+            .TotalWidth                        = dev.TotalWidth,
+            .DataWidth                         = dev.DataWidth,
+            .Size                              = memory_device_size(dev),
+            .FormFactor                        = dev.FormFactor,
+            .DeviceSet                         = dev.DeviceSet,
+            .DeviceLocator                     = string(dev.DeviceLocator),
+            .BankLocator                       = string(dev.BankLocator),
+            .MemoryType                        = static_cast<memory_type_t>(dev.MemoryType),
+            .TypeDetail                        = dev.TypeDetail,
+            // 0xffff: the speed is given by the Extended Speed
+            .Speed                             = dev.Speed == 0xffff ? dev.ExtendedSpeed : dev.Speed,
+            .Manufacturer                      = string(dev.Manufacturer),
+            .SerialNumber                      = string(dev.SerialNumber),
+            .AssetTag                          = string(dev.AssetTag),
+            .PartNumber                        = string(dev.PartNumber),
+            .Attributes                        = dev.Attributes,
+            .ConfiguredSpeed                   = dev.ConfiguredMemeorySpeed == 0xffff
+                                                     ? dev.ExtendedConfiguredMemeorySpeed
+                                                     : dev.ConfiguredMemeorySpeed,
+            .MinimumVoltage                    = dev.MinimumVoltage,
+            .MaximumVoltage                    = dev.MaximumVoltage,
+            .ConfiguredVoltage                 = dev.ConfiguredVoltage,
+            .Technology                        = dev.MemoryTechnology,
+            .OperatingModeCapability           = dev.MemoryOperatingModeCapability,
+            .FirmwareVersion                   = dev.FirmwareVersion,
+            .ModuleManufacturerID              = dev.ModuleManufacturerID,
+            .ModuleProductID                   = dev.ModuleProductID,
+            .SubsystemControllerManufacturerID = dev.MemorySubsystemControllerManufacturerID,
+            .SubsystemControllerProductID      = dev.MemorySubsystemControllerProductID,
+            .NonvolatileSize                   = dev.NonvolatileSize,
+            .VolatileSize                      = dev.VolatileSize,
+            .CacheSize                         = dev.CacheSize,
+            .LogicalSize                       = dev.LogicalSize,
+            .PMIC0ManufacturerID               = dev.PMIC0ManufacturerID,
+            .PMIC0RevisionNumber               = dev.PMIC0RevisionNumber,
+            .RCDManufacturerID                 = dev.RCDManufacturerID,
+            .RCDRevisionNumber                 = dev.RCDRevisionNumber,
+        };
+    }
+
+    std::vector<MemoryDevice> devices(std::span<const uint8_t> blob)
+    {
+        std::vector<MemoryDevice> list{};
+
+        for (const auto& structure : smbios::table_view{ blob }) {
+            if (structure.type == smbios::type_t::MemoryDevice) {
+                list.emplace_back(to_memory_device(structure));
+            }
+        }
+
+        return list;
+    }
+
+    std::vector<PhysicalMemoryArray> physical_device_arrays(std::span<const uint8_t> blob)
+    {
+        std::vector<PhysicalMemoryArray> list{};
+
+        for (const auto& structure : smbios::table_view{ blob }) {
+            if (structure.type == smbios::type_t::PhysicalMemoryArray) {
+                list.emplace_back(to_physical_memory_array(structure));
+            }
+        }
+
+        return list;
+    }
+
+    // the structures are walked in place, the item table of smbios() is not built
+    std::vector<MemoryDevice> devices() { return devices(smbios::structure_table()); }
+
+    std::vector<PhysicalMemoryArray> physical_device_arrays()
+    {
+        return physical_device_arrays(smbios::structure_table());
+    }
+} // namespace probe::memory
@@ -3,23 +3,40 @@
 #include "probe/defer.h"
 #include "probe/network.h"
 #include "probe/sysfs.h"
+#include "probe/thread.h"
+#include "probe/time.h"
 #include "probe/util.h"
 
+#include <algorithm>
 #include <arpa/inet.h>
-#include <filesystem>
-#include <fstream>
-#include <ifaddrs.h>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
 #include <linux/ethtool.h>
+#include <linux/if_link.h>
+#include <linux/inet_diag.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/sock_diag.h>
 #include <linux/sockios.h>
-#include <map>
+#include <linux/unix_diag.h>
 #include <net/if.h>
 #include <net/if_arp.h>
 #include <netinet/in.h>
-#include <regex>
-#include <cstring>
+#include <netinet/tcp.h>
+#include <optional>
+#include <poll.h>
+#include <span>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <type_traits>
 #include <unistd.h>
+#include <unordered_map>
 
 namespace probe::network
 {
@@ -32,172 +49,1416 @@ namespace probe::network
         return {};
     }
 
-    static std::vector<std::string> fread_list(const std::string& file)
+    // groups: the multicast groups to subscribe, e.g. RTMGRP_LINK
+    static int netlink_socket(int protocol, uint32_t groups = 0)
+    {
+        const int fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, protocol);
+        if (fd < 0) return -1;
+
+        sockaddr_nl local{};
+        local.nl_family = AF_NETLINK;
+        local.nl_groups = groups;
+        if (::bind(fd, reinterpret_cast<const sockaddr *>(&local), sizeof(local)) < 0) {
+            const auto err = errno;
+            ::close(fd);
+            errno = err;
+            return -1;
+        }
+
+        return fd;
+    }
+
+    // sends the request, and calls the handler for each reply until NLMSG_DONE, or for the single reply of
+    // a request without NLM_F_DUMP. a handler returning bool stops the dump by false
+    // return false if failed, the kernel replied an error, or a reply did not fit in the buffer (EMSGSIZE),
+    // the error number is left in errno
+    template<typename Handler>
+    static bool netlink_request(int fd, nlmsghdr *request, std::span<char> buffer, Handler&& handler)
     {
-        std::ifstream fd(file);
+        sockaddr_nl kernel{};
+        kernel.nl_family = AF_NETLINK;
+        if (::sendto(fd, request, request->nlmsg_len, 0, reinterpret_cast<sockaddr *>(&kernel),
+                     sizeof(kernel)) < 0)
+            return false;
+
+        iovec  iov{ .iov_base = buffer.data(), .iov_len = buffer.size() };
+        msghdr msg{};
+        msg.msg_iov    = &iov;
+        msg.msg_iovlen = 1;
+
+        while (true) {
+            const auto size = ::recvmsg(fd, &msg, 0);
+            if (size < 0 && errno == EINTR) continue;
+            if (size == 0) errno = EIO;
+            if (size <= 0) return false;
+
+            // the rest of the datagram is discarded, the messages can not be parsed
+            if (msg.msg_flags & MSG_TRUNC) {
+                errno = EMSGSIZE;
+                return false;
+            }
+
+            auto len = static_cast<int>(size);
+            for (auto nh = reinterpret_cast<nlmsghdr *>(buffer.data()); NLMSG_OK(nh, len);
+                 nh = NLMSG_NEXT(nh, len)) {
+                // the replies of a previous, interrupted request
+                if (nh->nlmsg_seq != request->nlmsg_seq) continue;
+
+                if (nh->nlmsg_type == NLMSG_DONE) return true;
+                if (nh->nlmsg_type == NLMSG_ERROR) {
+                    const auto error = static_cast<const nlmsgerr *>(NLMSG_DATA(nh))->error;
+                    if (error) errno = -error;
+                    return error == 0;
+                }
 
-        if (!fd.is_open() || !fd) return {};
+                if constexpr (std::is_same_v<std::invoke_result_t<Handler, nlmsghdr *>, bool>) {
+                    if (!handler(nh)) return true;
+                }
+                else {
+                    handler(nh);
+                }
 
-        std::vector<std::string> list{};
-        for (std::string line; std::getline(fd, line);) {
-            list.emplace_back(line);
+                if (!(nh->nlmsg_flags & NLM_F_MULTI)) return true;
+            }
         }
+    }
 
-        return list;
+    // RTM_NEWLINK: the name and the stats64 of the interface
+    static void parse_link(const nlmsghdr *nh, traffic_status_t& status)
+    {
+        const auto ifi = static_cast<const ifinfomsg *>(NLMSG_DATA(nh));
+        status.index   = static_cast<uint32_t>(ifi->ifi_index);
+
+        auto len = static_cast<int>(IFLA_PAYLOAD(nh));
+        for (auto rta = IFLA_RTA(ifi); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            switch (rta->rta_type) {
+            case IFLA_IFNAME: {
+                const auto name = static_cast<const char *>(RTA_DATA(rta));
+                status.name.assign(name, ::strnlen(name, RTA_PAYLOAD(rta)));
+                break;
+            }
+
+            case IFLA_STATS64: {
+                // the attributes are 4-byte aligned only
+                rtnl_link_stats64 stats{};
+                std::memcpy(&stats, RTA_DATA(rta), std::min<size_t>(sizeof(stats), RTA_PAYLOAD(rta)));
+
+                status.ibytes   = stats.rx_bytes;
+                status.obytes   = stats.tx_bytes;
+                status.ipackets = stats.rx_packets;
+                status.opackets = stats.tx_packets;
+                status.idrops   = stats.rx_dropped;
+                status.odrops   = stats.tx_dropped;
+                status.ierrors  = stats.rx_errors;
+                status.oerrors  = stats.tx_errors;
+                break;
+            }
+
+            default: break;
+            }
+        }
+    }
+
+    // the routing message is sent right after the header, e.g. ifinfomsg for RTM_GETLINK
+    template<typename Message, typename Handler>
+    static bool rtnl_request(int fd, uint16_t type, uint16_t flags, uint32_t seq, const Message& message,
+                             std::span<char> buffer, Handler&& handler)
+    {
+        struct
+        {
+            nlmsghdr header;
+            Message  message;
+        } request{};
+
+        request.header.nlmsg_len   = NLMSG_LENGTH(sizeof(Message));
+        request.header.nlmsg_type  = type;
+        request.header.nlmsg_flags = static_cast<uint16_t>(NLM_F_REQUEST | flags);
+        request.header.nlmsg_seq   = seq;
+        request.message            = message;
+
+        return netlink_request(fd, &request.header, buffer, std::forward<Handler>(handler));
+    }
+
+    // RTM_GETLINK of the interface, or of all interfaces if the index is 0
+    static bool link_request(int fd, uint32_t seq, uint32_t index, std::span<char> buffer,
+                             std::vector<traffic_status_t>& list)
+    {
+        ifinfomsg ifi{};
+        ifi.ifi_family = AF_UNSPEC;
+        ifi.ifi_index  = static_cast<int>(index);
+
+        size_t     size   = 0;
+        const auto handle = [&](const nlmsghdr *nh) {
+            if (nh->nlmsg_type != RTM_NEWLINK) return;
+
+            // the strings of the previous entries are reused
+            if (size == list.size()) list.emplace_back();
+            parse_link(nh, list[size++]);
+        };
+
+        const auto ok = rtnl_request(fd, RTM_GETLINK, index ? 0 : NLM_F_DUMP, seq, ifi, buffer, handle);
+
+        list.resize(size);
+        return ok;
+    }
+
+    struct link_t
+    {
+        uint32_t  index{};
+        adapter_t adapter{};
+    };
+
+    // RTM_NEWLINK: the name, type, flags, mtu and the hardware address of the interface
+    static void parse_adapter(const nlmsghdr *nh, link_t& link)
+    {
+        const auto ifi = static_cast<const ifinfomsg *>(NLMSG_DATA(nh));
+
+        link.index               = static_cast<uint32_t>(ifi->ifi_index);
+        link.adapter.type        = static_cast<if_type_t>(ifi->ifi_type);
+        link.adapter.description = probe::to_string(link.adapter.type) + " Interface";
+        link.adapter.enabled     = ifi->ifi_flags & IFF_UP;
+
+        // the first 6 bytes of the address, zeros if the interface has none, as SIOCGIFHWADDR
+        uint8_t address[6]{};
+
+        auto len = static_cast<int>(IFLA_PAYLOAD(nh));
+        for (auto rta = IFLA_RTA(ifi); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            switch (rta->rta_type) {
+            case IFLA_IFNAME: {
+                const auto name = static_cast<const char *>(RTA_DATA(rta));
+                link.adapter.name.assign(name, ::strnlen(name, RTA_PAYLOAD(rta)));
+                break;
+            }
+
+            case IFLA_MTU: {
+                uint32_t mtu{};
+                std::memcpy(&mtu, RTA_DATA(rta), std::min<size_t>(sizeof(mtu), RTA_PAYLOAD(rta)));
+                link.adapter.mtu = mtu;
+                break;
+            }
+
+            case IFLA_ADDRESS:
+                std::memcpy(address, RTA_DATA(rta), std::min<size_t>(sizeof(address), RTA_PAYLOAD(rta)));
+                break;
+
+            default: break;
+            }
+        }
+
+        char buffer[18]{};
+        ::snprintf(buffer, sizeof(buffer), "%02x:%02x:%02x:%02x:%02x:%02x", address[0], address[1],
+                   address[2], address[3], address[4], address[5]);
+        link.adapter.physical_address = buffer;
+        link.adapter.is_virtual       = virtual_physical_addresses.contains(std::string{ buffer, 8 });
+    }
+
+    struct address_t
+    {
+        uint32_t         index{};
+        int              family{};
+        std::string      address{}; // IPv4 "<address>", IPv6 "<address>/<prefix length>"
+        std::string_view label{};   // IPv4 only, points into the message
+        bool             permanent{}; // false if the address has a lifetime, e.g. leased by DHCP
+    };
+
+    // RTM_NEWADDR / RTM_DELADDR, return false if not an IPv4 or IPv6 address
+    static bool parse_address(const nlmsghdr *nh, address_t& address)
+    {
+        const auto ifa = static_cast<const ifaddrmsg *>(NLMSG_DATA(nh));
+        if (ifa->ifa_family != AF_INET && ifa->ifa_family != AF_INET6) return false;
+
+        address.index     = ifa->ifa_index;
+        address.family    = ifa->ifa_family;
+        address.permanent = ifa->ifa_flags & IFA_F_PERMANENT;
+
+        const void *data = nullptr;
+
+        auto len = static_cast<int>(IFA_PAYLOAD(nh));
+        for (auto rta = IFA_RTA(ifa); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            switch (rta->rta_type) {
+            case IFA_ADDRESS:
+                if (ifa->ifa_family == AF_INET6) data = RTA_DATA(rta);
+                break;
+
+            // the peer address is given by IFA_ADDRESS on point-to-point interfaces
+            case IFA_LOCAL:
+                if (ifa->ifa_family == AF_INET) data = RTA_DATA(rta);
+                break;
+
+            case IFA_LABEL: {
+                const auto str = static_cast<const char *>(RTA_DATA(rta));
+                address.label  = { str, ::strnlen(str, RTA_PAYLOAD(rta)) };
+                break;
+            }
+
+            default: break;
+            }
+        }
+
+        if (!data) return false;
+
+        char buffer[INET6_ADDRSTRLEN]{};
+        ::inet_ntop(ifa->ifa_family, data, buffer, sizeof(buffer));
+
+        address.address = buffer;
+        if (ifa->ifa_family == AF_INET6) address.address += "/" + std::to_string(ifa->ifa_prefixlen);
+
+        return true;
+    }
+
+    // - IPv4: the local address labeled with the interface name, only the first one as SIOCGIFADDR
+    // - IPv6: all addresses
+    static void add_address(adapter_t& adapter, const address_t& address)
+    {
+        if (address.family == AF_INET) {
+            if (adapter.ipv4_addresses.empty() && address.label == adapter.name)
+                adapter.ipv4_addresses.emplace_back(address.address);
+
+            if (!address.permanent) adapter.dhcp_enabled = true;
+        }
+        else if (std::ranges::count(adapter.ipv6_addresses, address.address) == 0) {
+            adapter.ipv6_addresses.emplace_back(address.address);
+        }
+    }
+
+    // dhcp_enabled is sticky, the permanence of the remaining addresses is not kept to recompute it
+    static void remove_address(adapter_t& adapter, const address_t& address)
+    {
+        auto& list = (address.family == AF_INET) ? adapter.ipv4_addresses : adapter.ipv6_addresses;
+        std::erase(list, address.address);
+    }
+
+    // dddd:bb:dd.f
+    static bool is_pci_address(std::string_view str)
+    {
+        constexpr std::string_view pattern = "dddd:dd:dd.d";
+        if (str.size() != pattern.size()) return false;
+
+        for (size_t i = 0; i < str.size(); ++i) {
+            const auto ch = static_cast<unsigned char>(str[i]);
+            if (pattern[i] == 'd' ? !std::isdigit(ch) : ch != pattern[i]) return false;
+        }
+        return true;
+    }
+
+    // the bus, PCI ids, driver and the wireless protocol; only the interfaces backed by a device have
+    // the 'device' link in sysfs
+    static void device_info(int fd, int classfd, adapter_t& adapter)
+    {
+        if (::faccessat(classfd, (adapter.name + "/device").c_str(), F_OK, 0) == 0) {
+            const auto [device_path, driver_path] = probe::sys::device_by_class("net", adapter.name);
+
+            adapter.id = device_path;
+            if (!driver_path.empty()) adapter.bus = bus_cast(probe::sys::guess_bus(driver_path));
+            if (is_pci_address(device_path.filename().string())) adapter.bus_info = device_path.filename();
+
+            // vendor & product
+            const int dirfd = ::open(device_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (dirfd >= 0) {
+                defer(::close(dirfd));
+
+                char       buffer[32];
+                const auto hex = [&](const char *file) -> std::optional<uint32_t> {
+                    auto str = probe::util::read_at(dirfd, file, buffer);
+                    if (str.starts_with("0x")) str.remove_prefix(2);
+
+                    uint32_t   value{};
+                    const auto [_, ec] = std::from_chars(str.data(), str.data() + str.size(), value, 16);
+                    if (str.empty() || ec != std::errc{}) return std::nullopt;
+                    return value;
+                };
+
+                if (const auto vendor_id = hex("vendor"); vendor_id) {
+                    adapter.vendor_id    = vendor_cast(*vendor_id);
+                    adapter.manufacturer = probe::to_string(adapter.vendor_id);
+
+                    if (const auto product_id = hex("device"); product_id) {
+                        adapter.product = probe::product_name(*vendor_id, *product_id);
+                    }
+                }
+            }
+        }
+        else {
+            adapter.bus = bus_cast(std::string{});
+        }
+
+        // SIOCGIWNAME
+        char buffer[2 * IFNAMSIZ + 1]{};
+        ::strncpy(buffer, adapter.name.c_str(), IFNAMSIZ - 1);
+        if (::ioctl(fd, 0x8B01, &buffer) == 0) {
+            adapter.description = "Wireless Interface (" + std::string{ buffer + IFNAMSIZ } + ")";
+        }
+
+        // driver
+        ifreq ifr{};
+        ::strncpy(ifr.ifr_name, adapter.name.c_str(), IFNAMSIZ - 1);
+
+        ethtool_drvinfo drvinfo{};
+        drvinfo.cmd  = ETHTOOL_GDRVINFO;
+        ifr.ifr_data = reinterpret_cast<caddr_t>(&drvinfo);
+        if (::ioctl(fd, SIOCETHTOOL, &ifr) == 0) {
+            adapter.driver         = drvinfo.driver;
+            adapter.driver_version = drvinfo.version;
+            if (drvinfo.bus_info[0] != '\0') adapter.bus_info = drvinfo.bus_info;
+        }
+    }
+
+    // the interfaces sorted by the index, and their addresses, without the device information
+    static bool dump_links(int fd, std::span<char> buffer, std::vector<link_t>& links)
+    {
+        links.clear();
+
+        ifinfomsg ifi{};
+        ifi.ifi_family = AF_UNSPEC;
+
+        const auto link_handler = [&](const nlmsghdr *nh) {
+            if (nh->nlmsg_type == RTM_NEWLINK) parse_adapter(nh, links.emplace_back());
+        };
+        if (!rtnl_request(fd, RTM_GETLINK, NLM_F_DUMP, 1, ifi, buffer, link_handler)) return false;
+
+        std::ranges::sort(links, {}, &link_t::index);
+
+        ifaddrmsg ifa{};
+        ifa.ifa_family = AF_UNSPEC;
+
+        address_t  address{};
+        const auto address_handler = [&](const nlmsghdr *nh) {
+            if (nh->nlmsg_type != RTM_NEWADDR || !parse_address(nh, address)) return;
+
+            const auto link = std::ranges::lower_bound(links, address.index, {}, &link_t::index);
+            if (link != links.end() && link->index == address.index) add_address(link->adapter, address);
+        };
+        return rtnl_request(fd, RTM_GETADDR, NLM_F_DUMP, 2, ifa, buffer, address_handler);
+    }
+
+    // fills the device information of the adapters
+    static void device_info(std::span<link_t> links)
+    {
+        const int fd      = ::socket(PF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        const int classfd = ::open("/sys/class/net", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        defer(if (fd >= 0) ::close(fd));
+        defer(if (classfd >= 0) ::close(classfd));
+
+        if (fd < 0) return;
+
+        for (auto& link : links) {
+            device_info(fd, classfd, link.adapter);
+        }
+    }
+
+    // RTM_NEWROUTE, appends a route per next hop
+    static void parse_route(const nlmsghdr *nh, std::vector<route_t>& list)
+    {
+        const auto rtm = static_cast<const rtmsg *>(NLMSG_DATA(nh));
+        if (rtm->rtm_family != AF_INET && rtm->rtm_family != AF_INET6) return;
+        if (rtm->rtm_flags & RTM_F_CLONED) return;
+
+        char buffer[INET6_ADDRSTRLEN]{};
+
+        const auto to_string = [&](const rtattr *rta) {
+            ::inet_ntop(rtm->rtm_family, RTA_DATA(rta), buffer, sizeof(buffer));
+            return std::string{ buffer };
+        };
+
+        const auto u32 = [](const rtattr *rta) {
+            uint32_t value{};
+            std::memcpy(&value, RTA_DATA(rta), std::min<size_t>(sizeof(value), RTA_PAYLOAD(rta)));
+            return value;
+        };
+
+        route_t route{
+            .family      = rtm->rtm_family,
+            .destination = rtm->rtm_family == AF_INET ? "0.0.0.0" : "::",
+            .prefix      = rtm->rtm_dst_len,
+            .table       = rtm->rtm_table,
+            .protocol    = rtm->rtm_protocol,
+            .scope       = rtm->rtm_scope,
+            .type        = rtm->rtm_type,
+        };
+
+        const rtattr *multipath = nullptr;
+
+        auto len = static_cast<int>(RTM_PAYLOAD(nh));
+        for (auto rta = RTM_RTA(rtm); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            switch (rta->rta_type) {
+            case RTA_DST:       route.destination = to_string(rta); break;
+            case RTA_GATEWAY:   route.gateway = to_string(rta); break;
+            case RTA_PREFSRC:   route.source = to_string(rta); break;
+            case RTA_OIF:       route.index = u32(rta); break;
+            case RTA_PRIORITY:  route.metric = u32(rta); break;
+            case RTA_TABLE:     route.table = u32(rta); break;
+            case RTA_MULTIPATH: multipath = rta; break;
+            default:            break;
+            }
+        }
+
+        if (!multipath) {
+            list.emplace_back(std::move(route));
+            return;
+        }
+
+        // rtnexthop, followed by the attributes of the next hop
+        auto size = static_cast<int>(RTA_PAYLOAD(multipath));
+        for (auto nhop = static_cast<const rtnexthop *>(RTA_DATA(multipath));
+             size >= static_cast<int>(sizeof(rtnexthop)) && nhop->rtnh_len >= sizeof(rtnexthop) &&
+             nhop->rtnh_len <= size;
+             size -= RTNH_ALIGN(nhop->rtnh_len), nhop = RTNH_NEXT(nhop)) {
+            auto& hop = list.emplace_back(route);
+            hop.index = static_cast<uint32_t>(nhop->rtnh_ifindex);
+
+            auto attrlen = static_cast<int>(nhop->rtnh_len - sizeof(rtnexthop));
+            for (auto rta = RTNH_DATA(nhop); RTA_OK(rta, attrlen); rta = RTA_NEXT(rta, attrlen)) {
+                if (rta->rta_type == RTA_GATEWAY) hop.gateway = to_string(rta);
+            }
+        }
+    }
+
+    // RTM_GETROUTE of both families, the routes of the table, or of all tables if 0
+    static bool dump_routes(int fd, uint32_t seq, uint32_t table, std::span<char> buffer,
+                            std::vector<route_t>& list)
+    {
+        rtmsg rtm{};
+        rtm.rtm_family = AF_UNSPEC;
+
+        const auto handler = [&](const nlmsghdr *nh) {
+            if (nh->nlmsg_type != RTM_NEWROUTE) return;
+
+            const auto size = list.size();
+            parse_route(nh, list);
+
+            // the kernel ignores the table of the dump request unless strict checking is enabled
+            if (table && size < list.size() && list.back().table != table) list.resize(size);
+        };
+
+        return rtnl_request(fd, RTM_GETROUTE, NLM_F_DUMP, seq, rtm, buffer, handler);
+    }
+
+    // "<key>=<value>" per line, e.g. the state files of systemd
+    static std::string_view env_value(std::string_view str, std::string_view key)
+    {
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            const auto line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
+
+            if (line.size() > key.size() && line.starts_with(key) && line[key.size()] == '=')
+                return line.substr(key.size() + 1);
+        }
+        return {};
+    }
+
+    // the words separated by spaces
+    template<typename F> static void for_each_word(std::string_view str, F&& f)
+    {
+        while (!str.empty()) {
+            const auto begin = str.find_first_not_of(" \t");
+            if (begin == std::string_view::npos) break;
+            str.remove_prefix(begin);
+
+            const auto end = std::min(str.find_first_of(" \t"), str.size());
+            f(str.substr(0, end));
+            str.remove_prefix(end);
+        }
+    }
+
+    static void add_dns_server(adapter_t& adapter, std::string_view server)
+    {
+        auto& list = (server.find(':') == std::string_view::npos) ? adapter.ipv4_dns_servers
+                                                                    : adapter.ipv6_dns_servers;
+        list.emplace_back(server);
+    }
+
+    // the global resolv.conf, or the upstream servers if it points to the stub resolver of systemd-resolved
+    static resolver_t global_resolver(std::span<char> buffer)
+    {
+        const auto read = [&](const char *path) {
+            return parse_resolv_conf(probe::util::read_at(AT_FDCWD, path, buffer));
+        };
+
+        auto resolver = read("/etc/resolv.conf");
+
+        const auto stub = std::vector<std::string>{ "127.0.0.53" };
+        if (resolver.ipv4_servers == stub && resolver.ipv6_servers.empty()) {
+            auto upstream = read("/run/systemd/resolve/resolv.conf");
+            if (!upstream.ipv4_servers.empty() || !upstream.ipv6_servers.empty()) {
+                resolver = std::move(upstream);
+            }
+        }
+
+        return resolver;
+    }
+
+    // gateways: the default routes of the main table
+    // DHCP:     the dynamic IPv4 addresses, the routes of the DHCP clients, or the systemd-networkd leases
+    // DNS:      the per-link servers of systemd-resolved, or resolv.conf for the interfaces with a gateway
+    static void network_config(int fd, std::span<char> buffer, std::vector<link_t>& links)
+    {
+        std::vector<route_t> routes{};
+        dump_routes(fd, 3, RT_TABLE_MAIN, buffer, routes);
+
+        const auto find = [&](uint32_t index) {
+            const auto it = std::ranges::lower_bound(links, index, {}, &link_t::index);
+            return (it != links.end() && it->index == index) ? &it->adapter : nullptr;
+        };
+
+        for (const auto& route : routes) {
+            const auto adapter = find(route.index);
+            if (!adapter) continue;
+
+            if (route.protocol == RTPROT_DHCP) adapter->dhcp_enabled = true;
+
+            if (route.prefix == 0 && route.type == RTN_UNICAST && !route.gateway.empty()) {
+                auto& gateways = route.family == AF_INET ? adapter->ipv4_gateways : adapter->ipv6_gateways;
+                if (std::ranges::count(gateways, route.gateway) == 0) gateways.emplace_back(route.gateway);
+            }
+        }
+
+        std::optional<resolver_t> global{};
+
+        char path[64];
+        for (auto& [index, adapter] : links) {
+            // systemd-networkd
+            ::snprintf(path, sizeof(path), "/run/systemd/netif/leases/%u", index);
+            if (const auto lease = probe::util::read_at(AT_FDCWD, path, buffer); !lease.empty()) {
+                adapter.dhcp_enabled  = true;
+                adapter.dhcpv4_server = env_value(lease, "SERVER_ADDRESS");
+            }
+
+            // systemd-resolved
+            ::snprintf(path, sizeof(path), "/run/systemd/resolve/netif/%u", index);
+            if (const auto state = probe::util::read_at(AT_FDCWD, path, buffer); !state.empty()) {
+                // "<address>" or "<address>#<server name>"
+                for_each_word(env_value(state, "SERVERS"), [&](auto server) {
+                    add_dns_server(adapter, server.substr(0, server.find('#')));
+                });
+
+                for_each_word(env_value(state, "DOMAINS"), [&](auto domain) {
+                    if (adapter.dns_suffix.empty()) adapter.dns_suffix = domain;
+                });
+            }
+
+            if (!adapter.ipv4_dns_servers.empty() || !adapter.ipv6_dns_servers.empty()) continue;
+            if (adapter.ipv4_gateways.empty() && adapter.ipv6_gateways.empty()) continue;
+
+            if (!global) global = global_resolver(buffer);
+
+            adapter.ipv4_dns_servers = global->ipv4_servers;
+            adapter.ipv6_dns_servers = global->ipv6_servers;
+            if (adapter.dns_suffix.empty() && !global->search.empty()) {
+                adapter.dns_suffix = global->search[0];
+            }
+        }
     }
 
     // A physical network interface represents a network hardware device such as NIC (Network Interface
     // Card), WNIC (Wireless Network Interface Card), or a modem.
     // A virtual network interface does not represent a hardware device but is linked to a network device.
     // It can be associated with a physical or virtual interface.
+    //
+    // the interfaces, their addresses and routes are dumped by RTM_GETLINK, RTM_GETADDR and RTM_GETROUTE in
+    // one pass, only the driver and the wireless protocol are left to the ioctls
     std::vector<adapter_t> adapters()
     {
-        ifaddrs *addresses;
-        if (::getifaddrs(&addresses) == -1) return {};
-        defer(::freeifaddrs(addresses));
-
-        std::vector<adapter_t> ret;
-
-        // device name
-        auto list = fread_list("/proc/net/dev");
-        if (list.size() <= 2) return {};
-
-        for (size_t i = 2; i < list.size(); ++i) {
-            auto lpos = list[i].find_first_not_of(probe::util::whitespace);
-            auto rpos = list[i].find(':');
-            if (lpos != std::string::npos && rpos != std::string::npos && lpos < rpos) {
-                ret.emplace_back(adapter_t{ .name = list[i].substr(lpos, rpos - lpos) });
-            }
-        }
-
-        // buses
-        auto buses = probe::sys::buses();
-
-        //
-        int fd = ::socket(PF_INET, SOCK_DGRAM, 0);
-        if (fd < 0) return ret;
-
-        for (size_t i = 0; i < ret.size(); ++i) {
-
-            // physical address
-            ifreq ifr{};
-            ::memset(&ifr, 0, sizeof(ifr));
-            ::strcpy(ifr.ifr_name, ret[i].name.c_str());
-            if (::ioctl(fd, SIOCGIFHWADDR, &ifr) == 0) {
-                ret[i].type        = static_cast<if_type_t>(ifr.ifr_hwaddr.sa_family);
-                ret[i].description = probe::to_string(ret[i].type) + " Interface";
-                // physical address
-                char buffer[18]{};
-                ::sprintf(buffer, "%02x:%02x:%02x:%02x:%02x:%02x",
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[0]),
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[1]),
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[2]),
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[3]),
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[4]),
-                          static_cast<unsigned char>(ifr.ifr_hwaddr.sa_data[5]));
-                ret[i].physical_address = buffer;
-            }
-
-            // mtu
-            if (::ioctl(fd, SIOCGIFMTU, &ifr) == 0) {
-                ret[i].mtu = ifr.ifr_mtu;
-            }
-
-            // ipv4 address
-            ifr.ifr_addr.sa_family = AF_INET;
-            if (::ioctl(fd, SIOCGIFADDR, &ifr) == 0) {
-                ret[i].ipv4_addresses.emplace_back(
-                    ::inet_ntoa(reinterpret_cast<sockaddr_in *>(&ifr.ifr_addr)->sin_addr));
-            }
-
-            // ipv6 address
-            {
-                auto ifv6_fd = ::fopen("/proc/net/if_inet6", "r");
-                if (ifv6_fd) {
-                    unsigned char ipv6[16]{};
-                    char          dname[IFNAMSIZ]{};
-                    unsigned int  if_idx{}, plen{}, scope{};
-
-                    while (20 == ::fscanf(ifv6_fd,
-                                          "%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx"
-                                          "%2hhx%2hhx%2hhx%2hhx %02x %02x %02x %*s %s",
-                                          &ipv6[0], &ipv6[1], &ipv6[2], &ipv6[3], &ipv6[4], &ipv6[5],
-                                          &ipv6[6], &ipv6[7], &ipv6[8], &ipv6[9], &ipv6[10], &ipv6[11],
-                                          &ipv6[12], &ipv6[13], &ipv6[14], &ipv6[15], &if_idx, &plen,
-                                          &scope, dname)) {
-                        if (::strcmp(dname, ret[i].name.c_str()) == 0) {
-                            char address[INET6_ADDRSTRLEN]{};
-                            ::inet_ntop(AF_INET6, ipv6, address, INET6_ADDRSTRLEN);
-                            ret[i].ipv6_addresses.emplace_back(std::string{ address } + "/" +
-                                                               std::to_string(plen));
-                        }
-                    }
+        const int nlfd = netlink_socket(NETLINK_ROUTE);
+        if (nlfd < 0) return {};
+        defer(::close(nlfd));
 
-                    ::fclose(ifv6_fd);
-                }
+        std::vector<char>   buffer(32'768);
+        std::vector<link_t> links{};
+        if (!dump_links(nlfd, buffer, links)) return {};
+
+        device_info(links);
+        network_config(nlfd, buffer, links);
+
+        std::vector<adapter_t> ret{};
+        ret.reserve(links.size());
+        for (auto& link : links) {
+            ret.emplace_back(std::move(link.adapter));
+        }
+
+        return ret;
+    }
+
+    // /sys/class/net/<name>/statistics
+    static traffic_status_t sysfs_status(const std::string& name)
+    {
+        traffic_status_t status{ .name = name, .index = ::if_nametoindex(name.c_str()) };
+
+        const int dirfd =
+            ::open(("/sys/class/net/" + name + "/statistics").c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirfd < 0) return status;
+        defer(::close(dirfd));
+
+        char       buffer[32];
+        const auto counter = [&](const char *file) {
+            const auto str = probe::util::read_at(dirfd, file, buffer);
+
+            uint64_t value{};
+            std::from_chars(str.data(), str.data() + str.size(), value);
+            return value;
+        };
+
+        status.ibytes   = counter("rx_bytes");
+        status.obytes   = counter("tx_bytes");
+        status.ipackets = counter("rx_packets");
+        status.opackets = counter("tx_packets");
+        status.idrops   = counter("rx_dropped");
+        status.odrops   = counter("tx_dropped");
+        status.ierrors  = counter("rx_errors");
+        status.oerrors  = counter("tx_errors");
+
+        return status;
+    }
+
+    traffic_status_t status(const adapter_t& adapter)
+    {
+        const auto index = ::if_nametoindex(adapter.name.c_str());
+        if (index == 0) return {};
+
+        const int fd = netlink_socket(NETLINK_ROUTE);
+        if (fd >= 0) {
+            defer(::close(fd));
+
+            char                          buffer[8'192];
+            std::vector<traffic_status_t> list{};
+            if (link_request(fd, 1, index, buffer, list) && list.size() == 1) return list[0];
+        }
+
+        return sysfs_status(adapter.name);
+    }
+
+    traffic_sampler::traffic_sampler()
+        : fd_(netlink_socket(NETLINK_ROUTE))
+    {
+        // the kernel fills up to a page or 8 KiB per recv
+        buffer_.resize(32'768);
+    }
+
+    traffic_sampler::~traffic_sampler()
+    {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    const std::vector<traffic_rate_t>& traffic_sampler::sample()
+    {
+        rates_.clear();
+
+        if (fd_ < 0 || !link_request(fd_, ++seq_, 0, buffer_, curr_)) return rates_;
+
+        const auto now     = time::relative_time();
+        const auto seconds = static_cast<double>(now - time_) / 1'000'000'000;
+
+        if (!std::ranges::is_sorted(curr_, {}, &traffic_status_t::index)) {
+            std::ranges::sort(curr_, {}, &traffic_status_t::index);
+        }
+
+        for (const auto& curr : curr_) {
+            const auto prev = std::ranges::lower_bound(prev_, curr.index, {}, &traffic_status_t::index);
+            if (prev == prev_.end() || prev->index != curr.index || seconds <= 0) continue;
+
+            // the counters may be reset, e.g. by reloading the driver
+            const auto rate = [&](uint64_t now, uint64_t before) {
+                return now >= before ? static_cast<double>(now - before) / seconds : 0.0;
+            };
+
+            rates_.emplace_back(traffic_rate_t{
+                .name     = curr.name,
+                .index    = curr.index,
+                .ibytes   = rate(curr.ibytes, prev->ibytes),
+                .obytes   = rate(curr.obytes, prev->obytes),
+                .ipackets = rate(curr.ipackets, prev->ipackets),
+                .opackets = rate(curr.opackets, prev->opackets),
+                .idrops   = rate(curr.idrops, prev->idrops),
+                .odrops   = rate(curr.odrops, prev->odrops),
+                .ierrors  = rate(curr.ierrors, prev->ierrors),
+                .oerrors  = rate(curr.oerrors, prev->oerrors),
+            });
+        }
+
+        prev_.swap(curr_);
+        time_ = now;
+
+        return rates_;
+    }
+} // namespace probe::network
+
+// NetlinkListener
+namespace probe::network
+{
+    using callback_t = std::function<void(const std::any&)>;
+
+    static void notify(const callback_t& callback, adapter_event_type_t type, const link_t& link,
+                       std::string address = {})
+    {
+        callback(adapter_event_t{
+            .type    = type,
+            .index   = link.index,
+            .adapter = link.adapter,
+            .address = std::move(address),
+        });
+    }
+
+    static void on_link(const nlmsghdr *nh, std::vector<link_t>& links, const callback_t& callback)
+    {
+        link_t link{};
+        parse_adapter(nh, link);
+
+        auto it = std::ranges::lower_bound(links, link.index, {}, &link_t::index);
+        if (it == links.end() || it->index != link.index) {
+            device_info({ &link, 1 });
+
+            it = links.insert(it, std::move(link));
+            return notify(callback, adapter_event_type_t::added, *it);
+        }
+
+        // the addresses and the device information are kept
+        it->adapter.name             = std::move(link.adapter.name);
+        it->adapter.type             = link.adapter.type;
+        it->adapter.enabled          = link.adapter.enabled;
+        it->adapter.mtu              = link.adapter.mtu;
+        it->adapter.physical_address = std::move(link.adapter.physical_address);
+        it->adapter.is_virtual       = link.adapter.is_virtual;
+
+        notify(callback, adapter_event_type_t::changed, *it);
+    }
+
+    static void on_message(const nlmsghdr *nh, std::vector<link_t>& links, const callback_t& callback)
+    {
+        switch (nh->nlmsg_type) {
+        case RTM_NEWLINK: on_link(nh, links, callback); break;
+
+        case RTM_DELLINK: {
+            const auto ifi   = static_cast<const ifinfomsg *>(NLMSG_DATA(nh));
+            const auto index = static_cast<uint32_t>(ifi->ifi_index);
+
+            const auto it = std::ranges::lower_bound(links, index, {}, &link_t::index);
+            if (it == links.end() || it->index != index) break;
+
+            const auto link = std::move(*it);
+            links.erase(it);
+            notify(callback, adapter_event_type_t::removed, link);
+            break;
+        }
+
+        case RTM_NEWADDR:
+        case RTM_DELADDR: {
+            address_t address{};
+            if (!parse_address(nh, address)) break;
+
+            const auto it = std::ranges::lower_bound(links, address.index, {}, &link_t::index);
+            if (it == links.end() || it->index != address.index) break;
+
+            if (nh->nlmsg_type == RTM_NEWADDR) {
+                add_address(it->adapter, address);
+                notify(callback, adapter_event_type_t::address_added, *it, std::move(address.address));
+            }
+            else {
+                remove_address(it->adapter, address);
+                notify(callback, adapter_event_type_t::address_removed, *it, std::move(address.address));
             }
+            break;
+        }
+
+        default: break;
+        }
+    }
+
+    static bool snapshot(std::span<char> buffer, std::vector<link_t>& links)
+    {
+        const int fd = netlink_socket(NETLINK_ROUTE);
+        if (fd < 0) return false;
+        defer(::close(fd));
+
+        if (!dump_links(fd, buffer, links)) return false;
+
+        device_info(links);
+        network_config(fd, buffer, links);
+        return true;
+    }
+
+    // the events are lost if the socket buffer overruns, compares the adapters with a new snapshot
+    static void resync(std::span<char> buffer, std::vector<link_t>& links, const callback_t& callback)
+    {
+        std::vector<link_t> latest{};
+        if (!snapshot(buffer, latest)) return;
+
+        for (const auto& link : links) {
+            if (!std::ranges::binary_search(latest, link.index, {}, &link_t::index))
+                notify(callback, adapter_event_type_t::removed, link);
+        }
+
+        // the adapters left as they were are not reported
+        for (const auto& link : latest) {
+            const auto it = std::ranges::lower_bound(links, link.index, {}, &link_t::index);
+            if (it == links.end() || it->index != link.index)
+                notify(callback, adapter_event_type_t::added, link);
+            else if (it->adapter != link.adapter)
+                notify(callback, adapter_event_type_t::changed, link);
+        }
+
+        links.swap(latest);
+    }
+
+    int NetlinkListener::listen(const std::any& obj, const callback_t& callback)
+    {
+        if (running_ || thread_.joinable()) return EBUSY;
+
+        uint32_t groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+        if (obj.has_value()) {
+            if (obj.type() != typeid(uint32_t)) return EINVAL;
+            groups = std::any_cast<uint32_t>(obj);
+        }
 
-            // bus info
-            auto [device_path, driver_path] = probe::sys::device_by_class("net", ret[i].name);
-            auto bus_name                   = probe::sys::guess_bus(driver_path);
-            ret[i].bus                      = bus_cast(bus_name);
-            ret[i].id                       = device_path;
-
-            if (std::regex_search(device_path.filename().string(),
-                                  std::regex(R"(^\d\d\d\d:\d\d:\d\d.\d$)"))) {
-                ret[i].bus_info = device_path.filename();
-            }
-
-            // vendor
-            auto vendor_fd = ::fopen((device_path / "vendor").c_str(), "r");
-            if (vendor_fd) {
-                uint32_t vendor_id{};
-                if (::fscanf(vendor_fd, "%x", &vendor_id) == 1) {
-                    ret[i].vendor_id    = vendor_cast(vendor_id);
-                    ret[i].manufacturer = probe::to_string(ret[i].vendor_id);
-
-                    // product
-                    uint32_t product_id{};
-                    auto     product_fd = ::fopen((device_path / "device").c_str(), "r");
-                    if (product_fd) {
-                        if (::fscanf(product_fd, "%x", &product_id) == 1) {
-                            ret[i].product = probe::product_name(vendor_id, product_id);
-                        }
-                        ::fclose(product_fd);
+        fd_ = netlink_socket(NETLINK_ROUTE, groups);
+        if (fd_ < 0) return errno;
+
+        event_ = ::eventfd(0, EFD_CLOEXEC);
+        if (event_ < 0) {
+            const auto err = errno;
+            ::close(std::exchange(fd_, -1));
+            return err;
+        }
+
+        // subscribed before the snapshot, the changes since then are queued on the socket
+        std::vector<char>   buffer(32'768);
+        std::vector<link_t> links{};
+        errno = 0;
+        if (!snapshot(buffer, links)) {
+            const auto err = errno ? errno : EIO;
+            ::close(std::exchange(event_, -1));
+            ::close(std::exchange(fd_, -1));
+            return err;
+        }
+
+        running_ = true;
+        thread_  = std::jthread([=, this, buffer = std::move(buffer), links = std::move(links)]() mutable {
+            probe::thread::set_name("listen-netlink");
+
+            pollfd fds[2]{
+                { .fd = fd_, .events = POLLIN, .revents = 0 },
+                { .fd = event_, .events = POLLIN, .revents = 0 },
+            };
+
+            while (running_) {
+                if (::poll(fds, 2, -1) < 0) {
+                    if (errno == EINTR) continue;
+                    break;
+                }
+
+                if (fds[1].revents) break;
+
+                const auto size = ::recv(fd_, buffer.data(), buffer.size(), 0);
+                if (size < 0) {
+                    if (errno == EINTR) continue;
+                    if (errno == ENOBUFS) {
+                        resync(buffer, links, callback);
+                        continue;
                     }
+                    break;
                 }
 
-                ::fclose(vendor_fd);
+                auto len = static_cast<int>(size);
+                for (auto nh = reinterpret_cast<nlmsghdr *>(buffer.data()); NLMSG_OK(nh, len) && running_;
+                     nh = NLMSG_NEXT(nh, len)) {
+                    on_message(nh, links, callback);
+                }
+            }
+
+            running_ = false;
+        });
+
+        return 0;
+    }
+
+    void NetlinkListener::stop()
+    {
+        running_ = false;
+
+        if (event_ >= 0) {
+            const uint64_t one = 1;
+            [[maybe_unused]] const auto _ = ::write(event_, &one, sizeof(one));
+        }
+
+        // called by the callback, the listening thread exits after the callback returns
+        if (thread_.get_id() == std::this_thread::get_id()) return;
+
+        if (thread_.joinable()) thread_.join();
+
+        if (fd_ >= 0) ::close(std::exchange(fd_, -1));
+        if (event_ >= 0) ::close(std::exchange(event_, -1));
+    }
+} // namespace probe::network
+
+// sockets
+namespace probe::network
+{
+    // inet_diag bytecode, the ports equal to the local and the remote port by a pair of >= and <=.
+    // each condition jumps to the next one if matched, otherwise beyond the end to reject the socket
+    static std::vector<inet_diag_bc_op> port_filter(uint16_t local, uint16_t remote)
+    {
+        std::vector<std::pair<uint8_t, uint16_t>> conditions{};
+        if (local) {
+            conditions.emplace_back(INET_DIAG_BC_S_GE, local);
+            conditions.emplace_back(INET_DIAG_BC_S_LE, local);
+        }
+        if (remote) {
+            conditions.emplace_back(INET_DIAG_BC_D_GE, remote);
+            conditions.emplace_back(INET_DIAG_BC_D_LE, remote);
+        }
+
+        // a condition is an operation followed by the port
+        constexpr size_t step = 2 * sizeof(inet_diag_bc_op);
+
+        std::vector<inet_diag_bc_op> ops{};
+        for (size_t i = 0; i < conditions.size(); ++i) {
+            const auto remaining = (conditions.size() - i) * step;
+
+            ops.emplace_back(inet_diag_bc_op{
+                .code = conditions[i].first,
+                .yes  = static_cast<uint8_t>(step),
+                .no   = static_cast<uint16_t>(remaining + 4),
+            });
+            ops.emplace_back(inet_diag_bc_op{ .code = 0, .yes = 0, .no = conditions[i].second });
+        }
+
+        return ops;
+    }
+
+    // the attributes follow the message, both are 4-byte aligned
+    template<typename Message> static const rtattr *first_attribute(const Message *msg)
+    {
+        const auto ptr = reinterpret_cast<const char *>(msg) + NLMSG_ALIGN(sizeof(Message));
+        return reinterpret_cast<const rtattr *>(ptr);
+    }
+
+    // all fields are assigned, the socket and its strings are reused by the dump
+    static void parse_inet(const nlmsghdr *nh, socket_protocol_t protocol, socket_t& socket)
+    {
+        const auto msg = static_cast<const inet_diag_msg *>(NLMSG_DATA(nh));
+
+        char buffer[INET6_ADDRSTRLEN]{};
+
+        socket.protocol = protocol;
+        socket.family   = msg->idiag_family;
+        socket.type     = (protocol == socket_protocol_t::tcp) ? SOCK_STREAM : SOCK_DGRAM;
+        socket.state    = static_cast<socket_state_t>(msg->idiag_state);
+
+        ::inet_ntop(msg->idiag_family, msg->id.idiag_src, buffer, sizeof(buffer));
+        socket.local_address = buffer;
+        socket.local_port    = ntohs(msg->id.idiag_sport);
+
+        ::inet_ntop(msg->idiag_family, msg->id.idiag_dst, buffer, sizeof(buffer));
+        socket.remote_address = buffer;
+        socket.remote_port    = ntohs(msg->id.idiag_dport);
+
+        socket.inode       = msg->idiag_inode;
+        socket.peer        = 0;
+        socket.uid         = msg->idiag_uid;
+        socket.rqueue      = msg->idiag_rqueue;
+        socket.wqueue      = msg->idiag_wqueue;
+        socket.rtt         = 0;
+        socket.rttvar      = 0;
+        socket.cwnd        = 0;
+        socket.retransmits = 0;
+
+        auto len = static_cast<int>(nh->nlmsg_len - NLMSG_LENGTH(sizeof(inet_diag_msg)));
+        for (auto rta = first_attribute(msg); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            if (rta->rta_type != INET_DIAG_INFO) continue;
+
+            // the size of tcp_info depends on the kernel version
+            tcp_info info{};
+            std::memcpy(&info, RTA_DATA(rta), std::min<size_t>(sizeof(info), RTA_PAYLOAD(rta)));
+
+            socket.rtt         = info.tcpi_rtt;
+            socket.rttvar      = info.tcpi_rttvar;
+            socket.cwnd        = info.tcpi_snd_cwnd;
+            socket.retransmits = info.tcpi_total_retrans;
+        }
+    }
+
+    static void parse_unix(const nlmsghdr *nh, socket_t& socket)
+    {
+        const auto msg = static_cast<const unix_diag_msg *>(NLMSG_DATA(nh));
+
+        socket.protocol = socket_protocol_t::unix_domain;
+        socket.family   = AF_UNIX;
+        socket.type     = msg->udiag_type;
+        socket.state    = static_cast<socket_state_t>(msg->udiag_state);
+        socket.local_address.clear();
+        socket.local_port = 0;
+        socket.remote_address.clear();
+        socket.remote_port = 0;
+        socket.inode       = msg->udiag_ino;
+        socket.peer        = 0;
+        socket.uid         = 0;
+        socket.rqueue      = 0;
+        socket.wqueue      = 0;
+        socket.rtt         = 0;
+        socket.rttvar      = 0;
+        socket.cwnd        = 0;
+        socket.retransmits = 0;
+
+        auto len = static_cast<int>(nh->nlmsg_len - NLMSG_LENGTH(sizeof(unix_diag_msg)));
+        for (auto rta = first_attribute(msg); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+            switch (rta->rta_type) {
+            case UNIX_DIAG_NAME: {
+                // not terminated, starts with '\0' if abstract
+                const auto name = static_cast<const char *>(RTA_DATA(rta));
+                const auto size = RTA_PAYLOAD(rta);
+                if (size > 0 && name[0] == '\0')
+                    socket.local_address.assign("@").append(name + 1, size - 1);
+                else
+                    socket.local_address.assign(name, ::strnlen(name, size));
+                break;
             }
 
-            // flags
-            if (::ioctl(fd, SIOCGIFFLAGS, &ifr) == 0) {
-                ret[i].enabled = ifr.ifr_flags & IFF_UP;
+            case UNIX_DIAG_PEER: {
+                uint32_t peer{};
+                std::memcpy(&peer, RTA_DATA(rta), std::min<size_t>(sizeof(peer), RTA_PAYLOAD(rta)));
+                socket.peer = peer;
+                break;
             }
 
-            char buffer[2 * IFNAMSIZ + 1]{};
-            ::strncpy(buffer, ret[i].name.c_str(), sizeof(buffer) - 1);
-            if (::ioctl(fd, 0x8B01, &buffer) == 0) {
-                ret[i].description = "Wireless Interface (" + std::string{ buffer + IFNAMSIZ } + ")";
+            case UNIX_DIAG_RQLEN: {
+                unix_diag_rqlen rqlen{};
+                std::memcpy(&rqlen, RTA_DATA(rta), std::min<size_t>(sizeof(rqlen), RTA_PAYLOAD(rta)));
+                socket.rqueue = rqlen.udiag_rqueue;
+                socket.wqueue = rqlen.udiag_wqueue;
+                break;
             }
 
-            // driver
-            ethtool_drvinfo drvinfo{};
-            drvinfo.cmd  = ETHTOOL_GDRVINFO;
-            ifr.ifr_data = reinterpret_cast<caddr_t>(&drvinfo);
-            if (::ioctl(fd, SIOCETHTOOL, &ifr) == 0) {
-                ret[i].driver         = drvinfo.driver;
-                ret[i].driver_version = drvinfo.version;
-                if (!std::string{ drvinfo.bus_info }.empty()) ret[i].bus_info = drvinfo.bus_info;
+            case UNIX_DIAG_UID: {
+                uint32_t uid{};
+                std::memcpy(&uid, RTA_DATA(rta), std::min<size_t>(sizeof(uid), RTA_PAYLOAD(rta)));
+                socket.uid = uid;
+                break;
             }
 
-            ret[i].is_virtual = virtual_physical_addresses.contains(ret[i].physical_address.substr(0, 8));
+            default: break;
+            }
         }
+    }
 
-        return ret;
+    // inode -> pid of the sockets, by the "socket:[<inode>]" links in /proc/<pid>/fd
+    static std::unordered_map<uint64_t, int64_t> socket_owners()
+    {
+        std::unordered_map<uint64_t, int64_t> owners{};
+
+        auto proc = ::opendir("/proc");
+        if (!proc) return owners;
+        defer(::closedir(proc));
+
+        char path[sizeof(dirent::d_name) + 16];
+        char link[64];
+
+        while (const auto entry = ::readdir(proc)) {
+            int64_t    pid{};
+            const auto end = entry->d_name + ::strlen(entry->d_name);
+            if (const auto [ptr, ec] = std::from_chars(entry->d_name, end, pid);
+                ec != std::errc{} || ptr != end || pid <= 0)
+                continue;
+
+            ::snprintf(path, sizeof(path), "/proc/%s/fd", entry->d_name);
+            const int fdfd = ::open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fdfd < 0) continue;
+
+            auto dir = ::fdopendir(fdfd);
+            if (!dir) {
+                ::close(fdfd);
+                continue;
+            }
+            defer(::closedir(dir));
+
+            while (const auto fd = ::readdir(dir)) {
+                if (fd->d_name[0] < '0' || fd->d_name[0] > '9') continue;
+
+                const auto size = ::readlinkat(fdfd, fd->d_name, link, sizeof(link));
+                if (size <= 9 || std::memcmp(link, "socket:[", 8) != 0) continue;
+
+                uint64_t inode{};
+                std::from_chars(link + 8, link + size - 1, inode);
+                owners.try_emplace(inode, pid);
+            }
+        }
+
+        return owners;
+    }
+
+    int sockets(const socket_filter_t& filter, const std::function<bool(const socket_t&)>& callback)
+    {
+        const int fd = netlink_socket(NETLINK_SOCK_DIAG);
+        if (fd < 0) return errno;
+        defer(::close(fd));
+
+        std::unordered_map<uint64_t, int64_t> owners{};
+        if (filter.owners) owners = socket_owners();
+
+        std::vector<char> buffer(32'768);
+        socket_t          socket{};
+        bool              stopped = false;
+        uint32_t          seq     = 0;
+
+        // a missing module fails its own dump only, the error is returned if all the dumps failed
+        size_t     requested = 0;
+        size_t     failed    = 0;
+        int        error     = 0;
+        const auto result    = [&](bool ok) {
+            requested++;
+            if (!ok) {
+                failed++;
+                error = errno ? errno : EIO;
+            }
+        };
+
+        const auto report = [&]() {
+            const auto owner = owners.find(socket.inode);
+            socket.pid       = (owner != owners.end()) ? owner->second : -1;
+
+            stopped = !callback(socket);
+            return !stopped;
+        };
+
+        // inet_diag, the bytecode is appended as the INET_DIAG_REQ_BYTECODE attribute
+        const auto ops    = port_filter(filter.local_port, filter.remote_port);
+        const auto bclen  = ops.size() * sizeof(inet_diag_bc_op);
+        const auto reqlen = NLMSG_LENGTH(sizeof(inet_diag_req_v2));
+
+        std::vector<char> request(reqlen + (ops.empty() ? 0 : RTA_LENGTH(bclen)));
+
+        const auto inet = [&](socket_protocol_t protocol, uint8_t family) {
+            std::ranges::fill(request, 0);
+
+            const auto header   = reinterpret_cast<nlmsghdr *>(request.data());
+            header->nlmsg_len   = static_cast<uint32_t>(request.size());
+            header->nlmsg_type  = SOCK_DIAG_BY_FAMILY;
+            header->nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+            header->nlmsg_seq   = ++seq;
+
+            const auto req      = static_cast<inet_diag_req_v2 *>(NLMSG_DATA(header));
+            req->sdiag_family   = family;
+            req->sdiag_protocol = (protocol == socket_protocol_t::tcp) ? IPPROTO_TCP : IPPROTO_UDP;
+            req->idiag_states   = filter.states;
+            if (protocol == socket_protocol_t::tcp && filter.tcp_info) {
+                req->idiag_ext = 1 << (INET_DIAG_INFO - 1);
+            }
+
+            if (!ops.empty()) {
+                const auto rta = reinterpret_cast<rtattr *>(request.data() + reqlen);
+                rta->rta_type  = INET_DIAG_REQ_BYTECODE;
+                rta->rta_len   = static_cast<uint16_t>(RTA_LENGTH(bclen));
+                std::memcpy(RTA_DATA(rta), ops.data(), bclen);
+            }
+
+            const auto handler = [&](const nlmsghdr *nh) {
+                if (nh->nlmsg_type != SOCK_DIAG_BY_FAMILY) return true;
+
+                parse_inet(nh, protocol, socket);
+                return report();
+            };
+
+            // fails if the module of the protocol is not loaded, e.g. udp_diag
+            errno = 0;
+            result(netlink_request(fd, header, buffer, handler));
+        };
+
+        if (filter.tcp) inet(socket_protocol_t::tcp, AF_INET);
+        if (filter.tcp && !stopped) inet(socket_protocol_t::tcp, AF_INET6);
+        if (filter.udp && !stopped) inet(socket_protocol_t::udp, AF_INET);
+        if (filter.udp && !stopped) inet(socket_protocol_t::udp, AF_INET6);
+
+        // unix_diag, no ports
+        if (filter.unix_domain && !filter.local_port && !filter.remote_port && !stopped) {
+            unix_diag_req req{};
+            req.sdiag_family = AF_UNIX;
+            req.udiag_states = filter.states;
+            req.udiag_show   = UDIAG_SHOW_NAME | UDIAG_SHOW_PEER | UDIAG_SHOW_RQLEN | UDIAG_SHOW_UID;
+
+            const auto handler = [&](const nlmsghdr *nh) {
+                if (nh->nlmsg_type != SOCK_DIAG_BY_FAMILY) return true;
+
+                parse_unix(nh, socket);
+                return report();
+            };
+            errno = 0;
+            result(rtnl_request(fd, SOCK_DIAG_BY_FAMILY, NLM_F_DUMP, ++seq, req, buffer, handler));
+        }
+
+        return (requested && failed == requested) ? error : 0;
+    }
+
+    std::vector<socket_t> sockets(const socket_filter_t& filter)
+    {
+        std::vector<socket_t> list{};
+
+        sockets(filter, [&](const socket_t& socket) {
+            list.emplace_back(socket);
+            return true;
+        });
+
+        return list;
+    }
+} // namespace probe::network
+
+// routes
+namespace probe::network
+{
+    std::vector<route_t> routes(uint32_t table)
+    {
+        std::vector<route_t> list{};
+
+        const int fd = netlink_socket(NETLINK_ROUTE);
+        if (fd < 0) return list;
+        defer(::close(fd));
+
+        std::vector<char> buffer(32'768);
+        if (!dump_routes(fd, 1, table, buffer, list)) return {};
+
+        // the names of the distinct interfaces
+        std::vector<std::pair<uint32_t, std::string>> names{};
+        for (auto& route : list) {
+            if (route.index == 0) continue;
+
+            auto it = std::ranges::find(names, route.index, &std::pair<uint32_t, std::string>::first);
+            if (it == names.end()) {
+                char name[IF_NAMESIZE]{};
+                if (!::if_indextoname(route.index, name)) name[0] = '\0';
+
+                it = names.emplace(names.end(), route.index, name);
+            }
+            route.name = it->second;
+        }
+
+        return list;
+    }
+
+    // inet_pton(3), the address in the network byte order
+    static size_t to_bytes(std::string_view str, int& family, uint8_t (&bytes)[16])
+    {
+        char address[INET6_ADDRSTRLEN]{};
+        if (str.empty() || str.size() >= sizeof(address)) return 0;
+        std::memcpy(address, str.data(), str.size());
+
+        family = (str.find(':') == std::string_view::npos) ? AF_INET : AF_INET6;
+        if (::inet_pton(family, address, bytes) != 1) return 0;
+
+        return family == AF_INET ? 4 : 16;
+    }
+
+    // the i-th bit from the most significant one
+    static bool bit_of(std::span<const uint8_t> bytes, size_t i)
+    {
+        return (bytes[i / 8] >> (7 - i % 8)) & 1;
     }
 
-    traffic_status_t status(const adapter_t&) { return {}; }
+    route_table::route_table(const std::vector<route_t>& list)
+    {
+        for (const auto& route : list) {
+            insert(route);
+        }
+    }
+
+    bool route_table::insert(const route_t& route)
+    {
+        int     family{};
+        uint8_t bytes[16]{};
+
+        const auto size = to_bytes(route.destination, family, bytes);
+        if (!size || route.prefix > size * 8) return false;
+
+        auto& nodes = (family == AF_INET) ? v4_ : v6_;
+
+        size_t node = 0;
+        for (size_t i = 0; i < route.prefix; ++i) {
+            const auto bit = bit_of({ bytes, size }, i);
+            if (nodes[node].next[bit] < 0) {
+                nodes[node].next[bit] = static_cast<int32_t>(nodes.size());
+                nodes.emplace_back();
+            }
+            node = static_cast<size_t>(nodes[node].next[bit]);
+        }
+
+        // the same prefix, e.g. the default routes of multiple interfaces
+        const auto current = nodes[node].route;
+        if (current >= 0 && routes_[current].metric <= route.metric) {
+            routes_.emplace_back(route);
+            return true;
+        }
+
+        nodes[node].route = static_cast<int32_t>(routes_.size());
+        routes_.emplace_back(route);
+        return true;
+    }
+
+    const route_t *route_table::lookup(int family, std::span<const uint8_t> address) const
+    {
+        if ((family != AF_INET || address.size() != 4) && (family != AF_INET6 || address.size() != 16))
+            return nullptr;
+
+        const auto& nodes = (family == AF_INET) ? v4_ : v6_;
+
+        int32_t best = nodes[0].route;
+        size_t  node = 0;
+        for (size_t i = 0; i < address.size() * 8; ++i) {
+            const auto next = nodes[node].next[bit_of(address, i)];
+            if (next < 0) break;
+
+            node = static_cast<size_t>(next);
+            if (nodes[node].route >= 0) best = nodes[node].route;
+        }
+
+        return best >= 0 ? &routes_[best] : nullptr;
+    }
+
+    const route_t *route_table::lookup(std::string_view destination) const
+    {
+        int     family{};
+        uint8_t bytes[16]{};
+
+        const auto size = to_bytes(destination, family, bytes);
+        if (!size) return nullptr;
+
+        return lookup(family, { bytes, size });
+    }
+
+    // nameserver <address>
+    // search <domain>...
+    // domain <domain>
+    resolver_t parse_resolv_conf(std::string_view str)
+    {
+        resolver_t resolver{};
+
+        while (!str.empty()) {
+            const auto eol = str.find('\n');
+            auto       line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
+
+            line = line.substr(0, line.find_first_of("#;"));
+
+            std::string_view keyword{};
+            size_t           count = 0;
+            for_each_word(line, [&](auto word) {
+                if (count++ == 0) {
+                    keyword = word;
+                    return;
+                }
+
+                if (keyword == "nameserver" && count == 2) {
+                    // "<address>%<scope>" for the link-local IPv6 addresses
+                    if (word.find(':') == std::string_view::npos)
+                        resolver.ipv4_servers.emplace_back(word);
+                    else
+                        resolver.ipv6_servers.emplace_back(word);
+                }
+                // the last one of "search" and "domain" wins
+                else if (keyword == "search" || keyword == "domain") {
+                    if (count == 2) resolver.search.clear();
+                    resolver.search.emplace_back(word);
+                }
+            });
+        }
+
+        return resolver;
+    }
 } // namespace probe::network
 
-#endif
\ No newline at end of file
+#endif
@@ -296,8 +296,15 @@ namespace probe::network
 
         return {
             .guid             = adapter.interface_guid,
+            .index            = row.InterfaceIndex,
             .ibytes           = row.InOctets,
             .obytes           = row.OutOctets,
+            .ipackets         = row.InUcastPkts + row.InNUcastPkts,
+            .opackets         = row.OutUcastPkts + row.OutNUcastPkts,
+            .idrops           = row.InDiscards,
+            .odrops           = row.OutDiscards,
+            .ierrors          = row.InErrors,
+            .oerrors          = row.OutErrors,
             .unicast_ibytes   = row.InUcastOctets,
             .unicast_obytes   = row.OutUcastOctets,
             .broadcast_ibytes = row.InBroadcastOctets,
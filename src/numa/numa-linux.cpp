@@ -0,0 +1,213 @@
+#ifdef __linux__
+
+#include "probe/numa.h"
+
+#include "probe/defer.h"
+#include "probe/thread.h"
+#include "probe/util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <span>
+#include <string_view>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace probe::numa
+{
+    static int node_dirfd()
+    {
+        return ::open("/sys/devices/system/node", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    }
+
+    // "10 20 20 10\n"
+    static std::vector<uint32_t> parse_distances(std::string_view str)
+    {
+        std::vector<uint32_t> distances{};
+
+        const char *ptr = str.data();
+        const char *end = str.data() + str.size();
+        while (ptr < end) {
+            if (*ptr == ' ' || *ptr == '\n') {
+                ptr++;
+                continue;
+            }
+
+            uint32_t   distance{};
+            const auto [next, ec] = std::from_chars(ptr, end, distance);
+            if (ec != std::errc{}) break;
+
+            distances.emplace_back(distance);
+            ptr = next;
+        }
+
+        return distances;
+    }
+
+    // "Node 0 MemTotal:       16318208 kB\nNode 0 MemFree:  ..."
+    static void parse_meminfo(std::string_view str, node_t& node)
+    {
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            auto       line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
+
+            const auto colon = line.find(':');
+            if (colon == std::string_view::npos) continue;
+
+            const auto key = line.substr(0, colon);
+            const auto sp  = key.rfind(' ');
+            if (sp == std::string_view::npos) continue;
+
+            uint64_t *field = nullptr;
+            if (key.substr(sp + 1) == "MemTotal")
+                field = &node.total;
+            else if (key.substr(sp + 1) == "MemFree")
+                field = &node.free;
+            else
+                continue;
+
+            line.remove_prefix(colon + 1);
+            while (!line.empty() && line.front() == ' ') line.remove_prefix(1);
+
+            uint64_t kb{};
+            std::from_chars(line.data(), line.data() + line.size(), kb);
+            *field = kb * 1'024;
+        }
+    }
+
+    static node_t read_node(int dirfd, uint32_t id, std::span<char> buffer)
+    {
+        node_t node{ .id = id };
+
+        char path[64];
+        const auto file = [&](const char *name) {
+            ::snprintf(path, sizeof(path), "node%u/%s", id, name);
+            return path;
+        };
+
+        node.cpus      = cpu::read_cpuset(dirfd, file("cpulist"), buffer);
+        node.distances = parse_distances(probe::util::read_at(dirfd, file("distance"), buffer));
+        parse_meminfo(probe::util::read_at(dirfd, file("meminfo"), buffer), node);
+
+        return node;
+    }
+
+    std::vector<node_t> nodes()
+    {
+        std::vector<node_t> ret{};
+
+        const int dirfd = node_dirfd();
+        if (dirfd < 0) return ret;
+        defer(::close(dirfd));
+
+        char buffer[4'096];
+        for (const auto id : cpu::read_cpuset(dirfd, "online", buffer).cpus()) {
+            ret.emplace_back(read_node(dirfd, static_cast<uint32_t>(id), buffer));
+        }
+
+        return ret;
+    }
+
+    node_t node(uint32_t id)
+    {
+        const int dirfd = node_dirfd();
+        if (dirfd < 0) return { .id = id };
+        defer(::close(dirfd));
+
+        char buffer[4'096];
+        return read_node(dirfd, id, buffer);
+    }
+
+    std::vector<std::vector<uint32_t>> distances()
+    {
+        std::vector<std::vector<uint32_t>> ret{};
+
+        const int dirfd = node_dirfd();
+        if (dirfd < 0) return ret;
+        defer(::close(dirfd));
+
+        char buffer[4'096];
+        char path[64];
+        for (const auto id : cpu::read_cpuset(dirfd, "online", buffer).cpus()) {
+            ::snprintf(path, sizeof(path), "node%zu/distance", id);
+            ret.emplace_back(parse_distances(probe::util::read_at(dirfd, path, buffer)));
+        }
+
+        return ret;
+    }
+
+    // the same mapping as cpu::topology(), which reads node<N>/cpulist once and caches it
+    std::vector<int32_t> cpu_nodes()
+    {
+        const auto topology = cpu::topology();
+        if (topology->processors.empty()) return {};
+
+        std::vector<int32_t> ret(topology->processors.back().id + 1, -1);
+        for (const auto& processor : topology->processors) ret[processor.id] = processor.node;
+        return ret;
+    }
+
+    int32_t node_of(uint32_t cpu)
+    {
+        const auto  topology   = cpu::topology();
+        const auto& processors = topology->processors;
+
+        const auto it = std::ranges::lower_bound(processors, cpu, {}, &cpu::processor_t::id);
+        return (it != processors.end() && it->id == cpu) ? it->node : -1;
+    }
+
+    int32_t current_node()
+    {
+        unsigned int cpu  = 0;
+        unsigned int node = 0;
+        if (::getcpu(&cpu, &node) < 0) return -1;
+
+        return static_cast<int32_t>(node);
+    }
+
+    int run_on_node(uint32_t id)
+    {
+        const int dirfd = node_dirfd();
+        if (dirfd < 0) return errno;
+        defer(::close(dirfd));
+
+        char buffer[4'096];
+        char path[64];
+        ::snprintf(path, sizeof(path), "node%u/cpulist", id);
+
+        const auto cpus = cpu::read_cpuset(dirfd, path, buffer);
+        if (cpus.empty()) return EINVAL;
+
+        return probe::thread::set_affinity(cpus);
+    }
+
+    // set_mempolicy(2), called directly instead of by libnuma
+    static int set_mempolicy(int mode, const std::vector<unsigned long>& nodemask)
+    {
+        // the kernel reads maxnode - 1 bits of the mask
+        const auto maxnode = nodemask.size() * sizeof(unsigned long) * 8 + 1;
+        if (::syscall(SYS_set_mempolicy, mode, nodemask.data(), nodemask.empty() ? 0 : maxnode) < 0)
+            return errno;
+        return 0;
+    }
+
+    int bind_memory(uint32_t id)
+    {
+        constexpr size_t bits = sizeof(unsigned long) * 8;
+
+        std::vector<unsigned long> nodemask(id / bits + 1);
+        nodemask[id / bits] |= 1ul << (id % bits);
+
+        return set_mempolicy(MPOL_BIND, nodemask);
+    }
+
+    int unbind_memory() { return set_mempolicy(MPOL_DEFAULT, {}); }
+} // namespace probe::numa
+
+#endif
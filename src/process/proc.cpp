@@ -5,12 +5,14 @@
 #include "probe/time.h"
 #include "probe/util.h"
 
+#include <algorithm>
+#include <charconv>
+#include <fcntl.h>
 #include <fstream>
-#include <map>
-#include <regex>
 #include <sstream>
 #include <string.h>
 #include <string>
+#include <unistd.h>
 
 namespace probe::process
 {
@@ -41,57 +43,120 @@ namespace probe::process
         return 0;
     }
 
+    static int proc_fd()
+    {
+        static const int fd = ::open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        return fd;
+    }
+
+    std::string_view read_proc(const char *path, std::span<char> buffer)
+    {
+        return probe::util::read_at(proc_fd(), path, buffer);
+    }
+
+    // <pid>/<name>
+    template<size_t N> static const char *proc_path(char (&path)[N], uint64_t pid, const char *name)
+    {
+        auto ptr = std::to_chars(path, path + N, pid).ptr;
+        *ptr++   = '/';
+        ::strncpy(ptr, name, N - (ptr - path) - 1);
+        path[N - 1] = '\0';
+        return path;
+    }
+
+    // space separated numeric fields
+    struct fields_t
+    {
+        const char *pos{};
+        const char *end{};
+
+        void skip()
+        {
+            while (pos < end && *pos == ' ') ++pos;
+            while (pos < end && *pos != ' ' && *pos != '\n') ++pos;
+        }
+
+        bool next(char& ch)
+        {
+            while (pos < end && *pos == ' ') ++pos;
+            if (pos >= end) return false;
+            ch = *pos++;
+            return true;
+        }
+
+        template<typename T> bool next(T& value)
+        {
+            while (pos < end && *pos == ' ') ++pos;
+            const auto [ptr, ec] = std::from_chars(pos, end, value);
+            pos                  = ptr;
+            return ec == std::errc{};
+        }
+
+        template<typename T, typename... Ts> bool next(T& value, Ts&...values)
+        {
+            return next(value) && next(values...);
+        }
+    };
+
     // /proc/[pid]/stat
-    pstat_t parse_stat(uint64_t pid) { return parse_stat(std::to_string(pid)); }
+    pstat_t parse_stat(uint64_t pid)
+    {
+        char    buffer[1'024];
+        pstat_t s{};
+        return parse_stat(pid, s, buffer) ? s : pstat_t{};
+    }
 
     pstat_t parse_stat(const std::string& pid)
     {
-        auto    stat_fd = ::fopen(("/proc/" + pid + "/stat").c_str(), "r");
+        char    buffer[1'024];
         pstat_t s{};
-        char    buffer[512]{};
-
-        if (stat_fd) {
-            defer(::fclose(stat_fd));
-
-            // https://man7.org/linux/man-pages/man5/proc.5.html
-            if (::fscanf(
-                    stat_fd,
-                    "%d %s "                   // pid, comm
-                    "%c %d "                   // state, ppid
-                    "%d %d %d %d "             // pgrp, session, tty_nr, tpgid
-                    "%u %lu %lu %lu %lu "      // flags, minflt, cminflt, majflt, cmajflt
-                    "%lu %lu %ld %ld "         // utime, stime, cutime, cstime
-                    "%ld %ld "                 // priority, nice
-                    "%ld "                     // num_threads
-                    "%*s "                     // itrealvalue, not maintained
-                    "%llu "                    // starttime
-                    "%lu "                     // vsize
-                    "%ld "                     // rss
-                    "%lu %lu %lu %lu %lu %lu " // rsslim, startcode, endcode, startstack, kstkesp, kstkeip
-                    "%*s %*s %*s %*s "         // signal, blocked, sigign, sigcatch, use /proc/[pid]/status
-                    "%lu %*s %*s "             // wchan, (nswap, cnswap: not maintained)
-                    "%d %d "                   // exit_signal, processor
-                    "%u %u "                   // rt_priority, policy (sched)
-                    "%llu %lu %ld"             // blkio_ticks, guest_time, cguest_time
-                    ,
-                    &s.pid, buffer, &s.state, &s.ppid, &s.pgrp, &s.session, &s.tty_nr, &s.tpgid, &s.flags,
-                    &s.minflt, &s.cminflt, &s.majflt, &s.cmajflt, &s.utime, &s.stime, &s.cutime, &s.cstime,
-                    &s.priority, &s.nice, &s.nb_threads, &s.starttime, &s.vsize, &s.rss, &s.rsslim,
-                    &s.startcode, &s.endcode, &s.startstack, &s.kstkesp, &s.kstkeip, &s.wchan,
-                    &s.exit_signal, &s.processor, &s.rt_priority, &s.policy, &s.blkio_ticks, &s.guest_time,
-                    &s.cguest_time) == 0) {
-                return {};
-            }
-        }
+        return parse_stat_text(read_proc((pid + "/stat").c_str(), buffer), s) ? s : pstat_t{};
+    }
 
-        std::string comm = buffer;
-        auto        fpos = comm.find_first_of("(");
-        auto        lpos = comm.find_last_of(")");
-        if (fpos != std::string::npos && lpos != std::string::npos) {
-            s.comm = comm.substr(fpos + 1, lpos - fpos - 1);
-        }
+    bool parse_stat(uint64_t pid, pstat_t& s, std::span<char> buffer)
+    {
+        char path[32];
+        return parse_stat_text(read_proc(proc_path(path, pid, "stat"), buffer), s);
+    }
+
+    // https://man7.org/linux/man-pages/man5/proc.5.html
+    bool parse_stat_text(std::string_view str, pstat_t& s)
+    {
+        // the comm may contain spaces and parentheses, it ends with the last ')'
+        const auto lpos = str.find('(');
+        const auto rpos = str.rfind(')');
+        if (lpos == std::string_view::npos || rpos == std::string_view::npos || rpos < lpos) return false;
+
+        fields_t fields{ str.data(), str.data() + lpos };
+        if (!fields.next(s.pid)) return false;
+
+        s.comm.assign(str.data() + lpos + 1, rpos - lpos - 1);
+
+        fields = { str.data() + rpos + 1, str.data() + str.size() };
+        if (!fields.next(s.state, s.ppid, s.pgrp, s.session, s.tty_nr, s.tpgid, s.flags, s.minflt, s.cminflt,
+                         s.majflt, s.cmajflt, s.utime, s.stime, s.cutime, s.cstime, s.priority, s.nice,
+                         s.nb_threads))
+            return false;
+
+        fields.skip(); // itrealvalue, not maintained
 
-        return s;
+        if (!fields.next(s.starttime, s.vsize, s.rss, s.rsslim, s.startcode, s.endcode, s.startstack,
+                         s.kstkesp, s.kstkeip))
+            return false;
+
+        // signal, blocked, sigignore, sigcatch, use /proc/[pid]/status
+        for (auto i = 0; i < 4; ++i) fields.skip();
+
+        if (!fields.next(s.wchan)) return false;
+
+        fields.skip(); // nswap, not maintained
+        fields.skip(); // cnswap, not maintained
+
+        // since Linux 2.1.22 ~ 2.6.24
+        fields.next(s.exit_signal, s.processor, s.rt_priority, s.policy, s.blkio_ticks, s.guest_time,
+                    s.cguest_time);
+
+        return true;
     }
 
     // /proc/[pid]/io
@@ -113,20 +178,6 @@ namespace probe::process
         return io;
     }
 
-    std::vector<unsigned long> parse_uids(const std::string& str)
-    {
-        std::smatch matchs;
-        if (std::regex_match(str, matchs, std::regex("(\\d+)\t(\\d+)\t(\\d+)\t(\\d+)"))) {
-            return {
-                std::stoul(matchs[1].str()),
-                std::stoul(matchs[2].str()),
-                std::stoul(matchs[3].str()),
-                std::stoul(matchs[4].str()),
-            };
-        }
-        return { 0, 0, 0, 0 };
-    }
-
     // /proc/[pid]/statm
     pstatm_t parse_statm(uint64_t pid) { return parse_statm(std::to_string(pid)); }
 
@@ -146,112 +197,171 @@ namespace probe::process
         return m;
     }
 
-    // /proc/[pid]/status
-    pstatus_t parse_status(uint64_t pid) { return parse_status(std::to_string(pid)); }
-
-    pstatus_t parse_status(const std::string& pid)
+    // value parsers of /proc/[pid]/status
+    static std::string_view status_value(std::string_view value)
     {
-        std::ifstream status_fd("/proc/" + pid + "/status");
-        if (!status_fd.is_open() || !status_fd) return {};
-
-        std::map<std::string, std::string> mapping;
-        for (std::string line; std::getline(status_fd, line);) {
-            auto pos = line.find_first_of(":");
-            if (pos != std::string::npos) {
-                mapping[line.substr(0, pos)] = line.substr(pos + 2); // skip ":\t"
-            }
-        }
-
-#define MAPPING_INT(X, F, D) (mapping.contains(#X) ? std::sto##F(mapping[#X]) : D)
-#define MAPPING_HEX(X, F, D) (mapping.contains(#X) ? std::sto##F(mapping[#X], nullptr, 16) : D)
-#define MAPPING_STR(X, D)    (mapping.contains(#X) ? mapping[#X] : D)
-
-        auto uids = parse_uids(MAPPING_STR(Uid, ""));
-        auto gids = parse_uids(MAPPING_STR(Gid, ""));
-
-        // clang-format off
-        return pstatus_t {
-            .name       = MAPPING_STR(Name, ""),
-
-#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 7, 0)
-            .umask      = (mapping.contains("Umask") ? std::stoul(mapping["Umask"], nullptr, 8) : 0),
-#endif
-
-            .state      = static_cast<pstate_t>(MAPPING_STR(State, std::string("\0"))[0]),
+        const auto pos = value.find_first_not_of(" \t");
+        return pos == std::string_view::npos ? std::string_view{} : value.substr(pos);
+    }
 
-            .tgid       = MAPPING_INT(Tgid, i, 0),
-            .ngid       = MAPPING_INT(Ngid, i, 0),
-            .pid        = MAPPING_INT(Pid, i, 0),
-            .ppid       = MAPPING_INT(PPid, i, 0),
+    template<auto Member, int Base = 10> static void status_integer(pstatus_t& s, std::string_view value)
+    {
+        value = status_value(value);
+        std::from_chars(value.data(), value.data() + value.size(), s.*Member, Base);
+    }
 
-            .tracer_pid = MAPPING_INT(TracerPid, i, 0),
+    template<auto Member> static void status_string(pstatus_t& s, std::string_view value)
+    {
+        (s.*Member).assign(value.data(), value.size());
+    }
 
-            .ruid       = static_cast<uid_t>(uids[0]),
-            .euid       = static_cast<uid_t>(uids[1]),
-            .suid       = static_cast<uid_t>(uids[2]),
-            .fuid       = static_cast<uid_t>(uids[3]),
+    static void status_state(pstatus_t& s, std::string_view value)
+    {
+        s.state = static_cast<pstate_t>(value.empty() ? '\0' : value[0]);
+    }
 
-            .rgid       = static_cast<gid_t>(gids[0]),
-            .egid       = static_cast<gid_t>(gids[1]),
-            .sgid       = static_cast<gid_t>(gids[2]),
-            .fgid       = static_cast<gid_t>(gids[3]),
+    // real, effective, saved set, and filesystem ids, separated by tabs
+    template<auto R, auto E, auto S, auto F> static void status_ids(pstatus_t& s, std::string_view value)
+    {
+        fields_t fields{ value.data(), value.data() + value.size() };
+        uint32_t ids[4]{};
+        for (auto& id : ids) {
+            if (fields.pos < fields.end && *fields.pos == '\t') ++fields.pos;
+            if (fields.pos >= fields.end || *fields.pos < '0' || *fields.pos > '9' || !fields.next(id)) return;
+        }
 
-            .fd_size    = MAPPING_INT(FDSize, l, 0),
-            .groups     = MAPPING_STR(Groups, ""),
+        s.*R = ids[0];
+        s.*E = ids[1];
+        s.*S = ids[2];
+        s.*F = ids[3];
+    }
 
+    struct status_key_t
+    {
+        std::string_view key;
+        void (*parse)(pstatus_t&, std::string_view);
+    };
+
+    // sorted by key
+    // clang-format off
+    static constexpr status_key_t status_keys[] = {
+        { "CapAmb",         status_integer<&pstatus_t::capamb, 16> },
+        { "CapBnd",         status_integer<&pstatus_t::capbnd, 16> },
+        { "CapEff",         status_integer<&pstatus_t::capeff, 16> },
+        { "CapInh",         status_integer<&pstatus_t::capinh, 16> },
+        { "CapPrm",         status_integer<&pstatus_t::capprm, 16> },
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
+        { "CoreDumping",    status_integer<&pstatus_t::core_dumping> },
+#endif
+        { "FDSize",         status_integer<&pstatus_t::fd_size> },
+        { "Gid",            status_ids<&pstatus_t::rgid, &pstatus_t::egid, &pstatus_t::sgid, &pstatus_t::fgid> },
+        { "Groups",         status_string<&pstatus_t::groups> },
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 4, 0)
+        { "HugetlbPages",   status_integer<&pstatus_t::hugetlb_pages> },
+#endif
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 1, 0)
-            .nstgid     = MAPPING_INT(NStgid, i, 0),
-            .nspid      = MAPPING_INT(NSpid, i, 0),
-            .nspgid     = MAPPING_INT(NSpgid, i, 0),
-            .nssid      = MAPPING_INT(NSsid, i, 0),
+        { "NSpgid",         status_integer<&pstatus_t::nspgid> },
+        { "NSpid",          status_integer<&pstatus_t::nspid> },
+        { "NSsid",          status_integer<&pstatus_t::nssid> },
+        { "NStgid",         status_integer<&pstatus_t::nstgid> },
 #endif
-
-            .vm_peak    = MAPPING_INT(VmPeak, ul, 0),
-            .vm_size    = MAPPING_INT(VmSize, ul, 0),
-            .vm_lck     = MAPPING_INT(VmLck, ul, 0),
-            .vm_pin     = MAPPING_INT(VmPin, ul, 0),
-            .vm_hwm     = MAPPING_INT(VmHWM, ul, 0),
-            .vm_rss     = MAPPING_INT(VmRSS, ul, 0),
-
+        { "Name",           status_string<&pstatus_t::name> },
+        { "Ngid",           status_integer<&pstatus_t::ngid> },
+        { "PPid",           status_integer<&pstatus_t::ppid> },
+        { "Pid",            status_integer<&pstatus_t::pid> },
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
-            .rss_anon   = MAPPING_INT(RssAnon, ul, 0),
-            .rss_file   = MAPPING_INT(RssFile, ul, 0),
-            .rss_shmem  = MAPPING_INT(RssShmem, ul, 0),
+        { "RssAnon",        status_integer<&pstatus_t::rss_anon> },
+        { "RssFile",        status_integer<&pstatus_t::rss_file> },
+        { "RssShmem",       status_integer<&pstatus_t::rss_shmem> },
 #endif
-            .vm_data    = MAPPING_INT(VmData,ul, 0),
-            .vm_stk     = MAPPING_INT(VmStk, ul, 0),
-            .vm_exe     = MAPPING_INT(VmExe, ul, 0),
-            .vm_lib     = MAPPING_INT(VmLib, ul, 0),
-            .vm_pte     = MAPPING_INT(VmPTE, ul, 0),
-            .vm_swap    = MAPPING_INT(VmSwap, ul, 0),
-
-#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 4, 0)
-            .hugetlb_pages = MAPPING_INT(HugetlbPages, ul, 0),
+        { "ShdPnd",         status_integer<&pstatus_t::shdpnd, 16> },
+        { "SigBlk",         status_integer<&pstatus_t::sigblk, 16> },
+        { "SigCgt",         status_integer<&pstatus_t::sigcgt, 16> },
+        { "SigIgn",         status_integer<&pstatus_t::sigign, 16> },
+        { "SigPnd",         status_integer<&pstatus_t::sigpnd, 16> },
+        { "State",          status_state },
+        { "Tgid",           status_integer<&pstatus_t::tgid> },
+        { "Threads",        status_integer<&pstatus_t::threads> },
+        { "TracerPid",      status_integer<&pstatus_t::tracer_pid> },
+        { "Uid",            status_ids<&pstatus_t::ruid, &pstatus_t::euid, &pstatus_t::suid, &pstatus_t::fuid> },
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 7, 0)
+        { "Umask",          status_integer<&pstatus_t::umask, 8> },
 #endif
+        { "VmData",         status_integer<&pstatus_t::vm_data> },
+        { "VmExe",          status_integer<&pstatus_t::vm_exe> },
+        { "VmHWM",          status_integer<&pstatus_t::vm_hwm> },
+        { "VmLck",          status_integer<&pstatus_t::vm_lck> },
+        { "VmLib",          status_integer<&pstatus_t::vm_lib> },
+        { "VmPTE",          status_integer<&pstatus_t::vm_pte> },
+        { "VmPeak",         status_integer<&pstatus_t::vm_peak> },
+        { "VmPin",          status_integer<&pstatus_t::vm_pin> },
+        { "VmRSS",          status_integer<&pstatus_t::vm_rss> },
+        { "VmSize",         status_integer<&pstatus_t::vm_size> },
+        { "VmStk",          status_integer<&pstatus_t::vm_stk> },
+        { "VmSwap",         status_integer<&pstatus_t::vm_swap> },
+        // the keys longer than the column above
+        { "nonvoluntary_ctxt_switches", status_integer<&pstatus_t::nonvoluntary_ctxt_switches> },
+        { "voluntary_ctxt_switches",    status_integer<&pstatus_t::voluntary_ctxt_switches> },
+    };
+    // clang-format on
+
+    static_assert(std::ranges::is_sorted(status_keys, {}, &status_key_t::key));
 
-#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
-            .core_dumping = MAPPING_INT(CoreDumping, i, 0),
-#endif
+    // /proc/[pid]/status
+    pstatus_t parse_status(uint64_t pid)
+    {
+        char      buffer[4'096];
+        pstatus_t s{};
+        return parse_status(pid, s, buffer) ? s : pstatus_t{};
+    }
+
+    pstatus_t parse_status(const std::string& pid)
+    {
+        char        buffer[4'096];
+        std::string overflow{};
+        pstatus_t   s{};
+        const auto  str = probe::util::read_at(proc_fd(), (pid + "/status").c_str(), buffer, overflow);
+        return parse_status_text(str, s) ? s : pstatus_t{};
+    }
+
+    bool parse_status(uint64_t pid, pstatus_t& s, std::span<char> buffer)
+    {
+        char        path[32];
+        std::string overflow{};
+        const auto  str = probe::util::read_at(proc_fd(), proc_path(path, pid, "status"), buffer, overflow);
+        return parse_status_text(str, s);
+    }
+
+    bool parse_status_text(std::string_view str, pstatus_t& s)
+    {
+        if (str.empty()) return false;
+
+        // reset all fields, but keep the capacity of the strings
+        auto name   = std::move(s.name);
+        auto groups = std::move(s.groups);
+        s           = {};
+        s.name      = std::move(name);
+        s.groups    = std::move(groups);
+        s.name.clear();
+        s.groups.clear();
+
+        while (!str.empty()) {
+            const auto eol  = str.find('\n');
+            const auto line = str.substr(0, eol);
+            str.remove_prefix(eol == std::string_view::npos ? str.size() : eol + 1);
+
+            // <key>:\t<value>
+            const auto pos = line.find(':');
+            if (pos == std::string_view::npos) continue;
+
+            const auto key = line.substr(0, pos);
+            const auto it  = std::ranges::lower_bound(status_keys, key, {}, &status_key_t::key);
+            if (it != std::end(status_keys) && it->key == key) {
+                it->parse(s, line.substr(std::min(pos + 2, line.size())));
+            }
+        }
 
-            .threads    = MAPPING_INT(Threads, l, 0),
-
-            .sigpnd     = MAPPING_HEX(SigPnd, ul, 0),
-            .shdpnd     = MAPPING_HEX(ShdPnd, ul, 0),
-            .sigblk     = MAPPING_HEX(SigBlk, ul, 0),
-            .sigign     = MAPPING_HEX(SigIgn, ul, 0),
-            .sigcgt     = MAPPING_HEX(SigCgt, ul, 0),
-
-            .capinh     = MAPPING_HEX(CapInh, ul, 0),
-            .capprm     = MAPPING_HEX(CapPrm, ul, 0),
-            .capeff     = MAPPING_HEX(CapEff, ul, 0),
-            .capbnd     = MAPPING_HEX(CapBnd, ul, 0),
-            .capamb     = MAPPING_HEX(CapAmb, ul, 0),
-        };
-        // clang-format on
-
-#undef MAPPING_HEX
-#undef MAPPING_INT
-#undef MAPPING_STR
+        return true;
     }
 
     // /proc/[pid]/environ
@@ -1,10 +1,27 @@
 #ifdef __linux__
 
+#include "probe/defer.h"
 #include "probe/process.h"
+#include "probe/time.h"
+#include "probe/util.h"
 
-#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
 #include <cinttypes>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <sys/stat.h>
+#include <thread>
 #include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 namespace probe::process
 {
@@ -40,54 +57,341 @@ namespace probe::process
     //
     // The proc filesystem is a pseudo-filesystem which provides an interface to kernel data structures. It
     // is commonly mounted at /proc.
-    std::vector<process_t> processes()
+    //
+    // calls f(pid) for each numerical subdirectory of /proc
+    template<typename F> static void for_each_pid(F&& f)
     {
-        std::vector<process_t> ret{};
+        auto dir = ::opendir("/proc");
+        if (!dir) return;
+        defer(::closedir(dir));
+
+        while (const auto entry = ::readdir(dir)) {
+            if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN) continue;
+
+            int64_t    pid{};
+            const auto end = entry->d_name + ::strlen(entry->d_name);
+            if (const auto [ptr, ec] = std::from_chars(entry->d_name, end, pid);
+                ec != std::errc{} || ptr != end || pid <= 0)
+                continue;
+
+            f(pid);
+        }
+    }
+
+    static std::string exe_path(int64_t pid)
+    {
+        const auto proc_exe = "/proc/" + std::to_string(pid) + "/exe";
+        try {
+            if (!::access(proc_exe.c_str(), R_OK) && std::filesystem::exists(proc_exe))
+                return std::filesystem::canonical(proc_exe);
+        }
+        catch (...) {
+        }
+        return {};
+    }
 
-        uint64_t sysuptime = uptime();
+    // uid -> user name, shared by all the enumerations and their worker threads
+    //  - the names are resolved by getpwuid_r() once, uids without an entry are cached as empty names,
+    //    the lookup errors are not cached
+    //  - the cache is cleared when the mtime of /etc/passwd changes, which is checked at most once a second
+    static std::string user_name(uid_t uid)
+    {
+        static std::shared_mutex                      mtx{};
+        static std::unordered_map<uid_t, std::string> names{};
+        static timespec                               mtime{};
+        static std::atomic<uint64_t>                  checked{}; // ns, relative_time()
+
+        const auto now  = time::relative_time();
+        auto       last = checked.load(std::memory_order_relaxed);
+        if (now - last >= 1'000'000'000 && checked.compare_exchange_strong(last, now)) {
+            struct stat st{};
+            if (::stat("/etc/passwd", &st) == 0) {
+                std::unique_lock lock(mtx);
+                if (st.st_mtim.tv_sec != mtime.tv_sec || st.st_mtim.tv_nsec != mtime.tv_nsec) {
+                    names.clear();
+                    mtime = st.st_mtim;
+                }
+            }
+        }
+
+        {
+            std::shared_lock lock(mtx);
+            if (const auto it = names.find(uid); it != names.end()) return it->second;
+        }
+
+        // may be a file parse or a network round trip with NSS, resolve it without holding the lock
+        const auto        max = ::sysconf(_SC_GETPW_R_SIZE_MAX);
+        std::vector<char> buffer(max > 0 ? static_cast<size_t>(max) : 1'024);
+        passwd            pwd{};
+        passwd           *result{};
+        int               rc{};
+        while ((rc = ::getpwuid_r(uid, &pwd, buffer.data(), buffer.size(), &result)) == ERANGE &&
+               buffer.size() < 1'048'576)
+            buffer.resize(buffer.size() * 2);
+
+        // EIO, EMFILE, an NSS timeout, ... may be transient, only the entry or its absence is cached
+        if (rc != 0) return {};
+
+        std::string      name = result ? result->pw_name : "";
+        std::unique_lock lock(mtx);
+        return names.try_emplace(uid, std::move(name)).first->second;
+    }
+
+    static process_t make_process(int64_t pid, const pstat_t& stat, const pstatus_t& status, uint64_t sysuptime)
+    {
+        return process_t{
+            .pid        = pid,
+            .ppid       = stat.ppid,
+            .state      = stat.state,
+            .priority   = stat.priority,
+            .name       = stat.comm,
+            .path       = exe_path(pid),
+            .cmdline    = parse_cmdline(pid),
+            .starttime  = (stat.starttime / sysconf(_SC_CLK_TCK)) * 1'000'000'000 + sysuptime,
+            .nb_threads = static_cast<uint64_t>(stat.nb_threads),
+            .user       = user_name(status.ruid),
+        };
+    }
+
+    // probes the given processes with its own parse buffers
+    static void probe(std::span<const int64_t> pids, uint64_t sysuptime, std::vector<process_t>& ret)
+    {
+        char      buffer[4'096];
+        pstat_t   stat{};
+        pstatus_t status{};
 
-        for (const auto& entry : std::filesystem::directory_iterator{ "/proc" }) {
-            std::string path = entry.path(); // /proc/<PID>
-            std::string pids = entry.path().filename();
-            // numerical subdirectory for each running process
-            if (!entry.is_directory() || !(pids[0] > '0' && pids[0] <= '9')) continue;
+        ret.reserve(ret.size() + pids.size());
 
+        for (const auto pid : pids) {
             // /proc/<PID>/stat
-            auto stat = parse_stat(pids);
+            if (!parse_stat(pid, stat, buffer)) continue;
 
             // /proc/<PID>/status
-            auto status = parse_status(pids);
+            parse_status(pid, status, buffer);
 
-            // user
-            auto pws = getpwuid(status.ruid);
+            ret.emplace_back(make_process(pid, stat, status, sysuptime));
+        }
+    }
+
+    std::vector<process_t> processes() { return processes(1); }
+
+    std::vector<process_t> processes(size_t nb_threads)
+    {
+        std::vector<int64_t> pids{};
+        for_each_pid([&](int64_t pid) { pids.emplace_back(pid); });
+
+        const uint64_t sysuptime = uptime();
 
-            // path
-            std::string proc_exe = "/proc/" + pids + "/exe", proc_path{};
-            try {
-                if (!::access(proc_exe.c_str(), R_OK) && std::filesystem::exists(proc_exe))
-                    proc_path = std::filesystem::canonical(proc_exe);
+        if (nb_threads == 0) nb_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        nb_threads = std::clamp<size_t>(nb_threads, 1, std::max<size_t>(pids.size(), 1));
+
+        std::vector<process_t> ret{};
+        if (nb_threads == 1) {
+            probe(pids, sysuptime, ret);
+            return ret;
+        }
+
+        // the workers only touch their own part of the pid list and their own result,
+        // and the results are concatenated in the order of the pid list
+        std::vector<std::vector<process_t>> results(nb_threads);
+        {
+            std::vector<std::jthread> workers{};
+            workers.reserve(nb_threads);
+            for (size_t i = 0; i < nb_threads; ++i) {
+                const auto first = pids.size() * i / nb_threads;
+                const auto last  = pids.size() * (i + 1) / nb_threads;
+
+                workers.emplace_back([&, i, first, last] {
+                    probe(std::span{ pids }.subspan(first, last - first), sysuptime, results[i]);
+                });
             }
-            catch (...) {
-                proc_path = {};
+        }
+
+        size_t size = 0;
+        for (const auto& result : results) size += result.size();
+        ret.reserve(size);
+
+        for (auto& result : results) {
+            std::ranges::move(result, std::back_inserter(ret));
+        }
+
+        return ret;
+    }
+
+    snapshotter::delta_t snapshotter::update()
+    {
+        delta_t    delta{};
+        const auto generation = ++generation_;
+        const auto sysuptime  = uptime();
+
+        char      buffer[4'096];
+        pstat_t   stat{};
+        pstatus_t status{};
+
+        for_each_pid([&](int64_t pid) {
+            // the only file re-read for the known processes
+            if (!parse_stat(pid, stat, buffer)) return;
+
+            auto it = entries_.find(pid);
+
+            // the pid has been reused by a new process
+            if (it != entries_.end() && it->second.starttime != stat.starttime) {
+                delta.removed.emplace_back(std::move(it->second.process));
+                entries_.erase(it);
+                it = entries_.end();
             }
 
-            ret.emplace_back(process_t{
-                .pid        = std::stoi(pids),
-                .ppid       = stat.ppid,
-                .state      = stat.state,
-                .priority   = stat.priority,
-                .name       = stat.comm,
-                .path       = proc_path,
-                .cmdline    = parse_cmdline(pids),
-                .starttime  = (stat.starttime / sysconf(_SC_CLK_TCK)) * 1'000'000'000 + sysuptime,
-                .nb_threads = static_cast<uint64_t>(stat.nb_threads),
-                .user       = pws->pw_name,
-            });
+            // new process, read the static fields once
+            if (it == entries_.end()) {
+                if (!parse_status(pid, status, buffer)) return;
+
+                const auto& entry = entries_[pid] = entry_t{
+                    .starttime  = stat.starttime,
+                    .generation = generation,
+                    .process    = make_process(pid, stat, status, sysuptime),
+                };
+                delta.added.emplace_back(entry.process);
+                return;
+            }
+
+            auto& entry      = it->second;
+            auto& process    = entry.process;
+            entry.generation = generation;
+
+            const auto nb_threads = static_cast<uint64_t>(stat.nb_threads);
+            if (process.ppid != stat.ppid || process.state != stat.state || process.priority != stat.priority ||
+                process.nb_threads != nb_threads || process.name != stat.comm) {
+                // exec(2) keeps the pid and the starttime, the image is read again if the name changed
+                if (process.name != stat.comm) {
+                    process.path    = exe_path(pid);
+                    process.cmdline = parse_cmdline(pid);
+                    if (parse_status(pid, status, buffer)) process.user = user_name(status.ruid);
+                }
+
+                process.ppid       = stat.ppid;
+                process.state      = stat.state;
+                process.priority   = stat.priority;
+                process.nb_threads = nb_threads;
+                process.name       = stat.comm;
+
+                delta.changed.emplace_back(process);
+            }
+        });
+
+        // not seen by this update
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.generation != generation) {
+                delta.removed.emplace_back(std::move(it->second.process));
+                it = entries_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        return delta;
+    }
+
+    std::vector<process_t> snapshotter::processes() const
+    {
+        std::vector<process_t> ret{};
+        ret.reserve(entries_.size());
+
+        for (const auto& [_, entry] : entries_) {
+            ret.emplace_back(entry.process);
         }
 
         return ret;
     }
 
+    // Fibonacci hashing, the capacity of the table is a power of 2
+    static size_t slot_index(int64_t pid, size_t capacity)
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(pid) * 0x9E37'79B9'7F4A'7C15ull) >> 32) &
+               (capacity - 1);
+    }
+
+    template<typename Slot> static Slot *slot_find(std::vector<Slot>& table, int64_t pid)
+    {
+        if (table.empty()) return nullptr;
+
+        for (auto i = slot_index(pid, table.size());; i = (i + 1) & (table.size() - 1)) {
+            if (table[i].pid == pid) return &table[i];
+            if (table[i].pid == 0) return nullptr;
+        }
+    }
+
+    // the pid must not be in the table, keeps the load factor below 1/2
+    template<typename Slot> static void slot_insert(std::vector<Slot>& table, size_t& size, const Slot& slot)
+    {
+        if ((size + 1) * 2 > table.size()) {
+            std::vector<Slot> old(std::max<size_t>(table.size() * 2, 1'024));
+            old.swap(table);
+
+            for (const auto& s : old) {
+                if (s.pid != 0) {
+                    auto i = slot_index(s.pid, table.size());
+                    while (table[i].pid != 0) i = (i + 1) & (table.size() - 1);
+                    table[i] = s;
+                }
+            }
+        }
+
+        auto i = slot_index(slot.pid, table.size());
+        while (table[i].pid != 0) i = (i + 1) & (table.size() - 1);
+        table[i] = slot;
+        ++size;
+    }
+
+    const std::vector<cpu_usage_t>& cpu_sampler::sample()
+    {
+        const auto now     = time::relative_time();
+        const auto seconds = static_cast<double>(now - time_) / 1'000'000'000;
+        const auto ticks   = static_cast<double>(sysconf(_SC_CLK_TCK));
+
+        usages_.clear();
+        std::ranges::fill(curr_, slot_t{});
+
+        char    buffer[1'024];
+        pstat_t stat{};
+        size_t  size = 0;
+
+        for_each_pid([&](int64_t pid) {
+            if (!parse_stat(pid, stat, buffer)) return;
+
+            const slot_t slot{
+                .pid       = pid,
+                .starttime = stat.starttime,
+                .utime     = stat.utime,
+                .stime     = stat.stime,
+                .minflt    = stat.minflt,
+                .majflt    = stat.majflt,
+            };
+            slot_insert(curr_, size, slot);
+
+            // not seen by the previous sample, or the pid has been reused
+            const auto prev = slot_find(prev_, pid);
+            if (!prev || prev->starttime != slot.starttime || seconds <= 0) return;
+
+            const auto user   = static_cast<double>(slot.utime - prev->utime) / ticks / seconds * 100;
+            const auto system = static_cast<double>(slot.stime - prev->stime) / ticks / seconds * 100;
+
+            usages_.emplace_back(cpu_usage_t{
+                .pid    = pid,
+                .usage  = user + system,
+                .user   = user,
+                .system = system,
+                .minflt = static_cast<double>(slot.minflt - prev->minflt) / seconds,
+                .majflt = static_cast<double>(slot.majflt - prev->majflt) / seconds,
+            });
+        });
+
+        prev_.swap(curr_);
+        time_ = now;
+
+        return usages_;
+    }
+
     int64_t id() { return getpid(); }
 
     std::string name(uint64_t pid) { return parse_comm(pid); }
@@ -101,7 +405,64 @@ namespace probe::process
         return {};
     }
 
-    std::vector<thread_t> threads(uint64_t) { return {}; }
+    std::vector<thread_t> threads(uint64_t pid)
+    {
+        std::vector<thread_t> ret{};
+        threads(pid, ret);
+        return ret;
+    }
+
+    // /proc/[pid]/task/[tid]/stat and /proc/[pid]/task/[tid]/status, opened relative to the task directory
+    bool threads(uint64_t pid, std::vector<thread_t>& list)
+    {
+        char path[sizeof(dirent::d_name) + 16];
+        ::snprintf(path, sizeof(path), "/proc/%" PRIu64 "/task", pid);
+
+        const int taskfd = ::open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (taskfd < 0) return false;
+
+        auto dir = ::fdopendir(taskfd);
+        if (!dir) {
+            ::close(taskfd);
+            return false;
+        }
+        defer(::closedir(dir));
+
+        const uint64_t ticks = sysconf(_SC_CLK_TCK);
+
+        char        buffer[4'096];
+        std::string overflow{};
+        pstat_t     stat{};
+        pstatus_t   status{};
+        size_t      count = 0;
+
+        while (const auto entry = ::readdir(dir)) {
+            if (entry->d_name[0] < '0' || entry->d_name[0] > '9') continue;
+
+            // the thread may exit at any time
+            ::snprintf(path, sizeof(path), "%s/stat", entry->d_name);
+            if (!parse_stat_text(util::read_at(taskfd, path, buffer), stat)) continue;
+
+            ::snprintf(path, sizeof(path), "%s/status", entry->d_name);
+            if (!parse_status_text(util::read_at(taskfd, path, buffer, overflow), status)) status = {};
+
+            // reuse the elements and their strings of the last call
+            if (count == list.size()) list.emplace_back();
+            auto& thread = list[count++];
+
+            thread.tid                        = static_cast<uint64_t>(stat.pid);
+            thread.name                       = stat.comm;
+            thread.state                      = stat.state;
+            thread.utime                      = stat.utime * 1'000'000'000 / ticks;
+            thread.stime                      = stat.stime * 1'000'000'000 / ticks;
+            thread.processor                  = stat.processor;
+            thread.voluntary_ctxt_switches    = status.voluntary_ctxt_switches;
+            thread.nonvoluntary_ctxt_switches = status.nonvoluntary_ctxt_switches;
+        }
+
+        list.resize(count);
+        return true;
+    }
 
     uint64_t memory(uint64_t pid)
     {
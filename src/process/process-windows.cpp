@@ -88,6 +88,8 @@ namespace probe::process
         return ret;
     }
 
+    std::vector<process_t> processes(size_t) { return processes(); }
+
     int64_t id() { return static_cast<int64_t>(::GetCurrentProcessId()); }
 
     std::string path(uint64_t pid)
@@ -146,6 +148,12 @@ namespace probe::process
         return ret;
     }
 
+    bool threads(uint64_t pid, std::vector<thread_t>& list)
+    {
+        list = threads(pid);
+        return !list.empty();
+    }
+
     uint64_t memory(uint64_t pid)
     {
         PROCESS_MEMORY_COUNTERS mem{};
@@ -2,7 +2,12 @@
 
 #include "probe/thread.h"
 
+#include "probe/defer.h"
+
+#include <algorithm>
+#include <cerrno>
 #include <pthread.h>
+#include <sched.h>
 
 namespace probe::thread
 {
@@ -19,6 +24,47 @@ namespace probe::thread
     }
 
     std::string name() { return name(static_cast<uint64_t>(::pthread_self())); }
+
+    // the sets are allocated dynamically, the fixed cpu_set_t is limited to 1024 processors
+    int set_affinity(const cpu::cpuset_t& cpus)
+    {
+        const auto count = std::max<size_t>(cpus.words.size() * 64, CPU_SETSIZE);
+        const auto size  = CPU_ALLOC_SIZE(count);
+
+        const auto set = CPU_ALLOC(count);
+        if (!set) return ENOMEM;
+        defer(CPU_FREE(set));
+
+        CPU_ZERO_S(size, set);
+        for (const auto cpu : cpus.cpus()) CPU_SET_S(cpu, size, set);
+
+        return ::pthread_setaffinity_np(::pthread_self(), size, set);
+    }
+
+    cpu::cpuset_t affinity()
+    {
+        cpu::cpuset_t ret{};
+
+        // EINVAL if the set is smaller than the kernel mask, retry with a larger one
+        for (size_t count = CPU_SETSIZE; count <= 1 << 20; count *= 2) {
+            const auto size = CPU_ALLOC_SIZE(count);
+
+            const auto set = CPU_ALLOC(count);
+            if (!set) return ret;
+            defer(CPU_FREE(set));
+
+            const auto err = ::pthread_getaffinity_np(::pthread_self(), size, set);
+            if (err == EINVAL) continue;
+            if (err != 0) return ret;
+
+            for (size_t cpu = 0; cpu < count; ++cpu) {
+                if (CPU_ISSET_S(cpu, size, set)) ret.set(cpu);
+            }
+            return ret;
+        }
+
+        return ret;
+    }
 } // namespace probe::thread
 
 #endif
\ No newline at end of file
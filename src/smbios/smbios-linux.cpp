@@ -2,12 +2,87 @@
 
 #include "probe/smbios.h"
 
+#include "probe/defer.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace probe::smbios
 {
-    smbios_t smbios()
+    // the whole file, sized by fstat(2), sysfs reports the size of the binary attributes
+    static std::vector<uint8_t> read_blob(const std::string& path)
     {
+        std::vector<uint8_t> blob{};
+
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return blob;
+        defer(::close(fd));
+
+        struct stat st{};
+        if (::fstat(fd, &st) < 0) return blob;
+
+        blob.resize(st.st_size > 0 ? static_cast<size_t>(st.st_size) : 4'096);
+
+        size_t size = 0;
+        while (true) {
+            const auto n = ::read(fd, blob.data() + size, blob.size() - size);
+            if (n <= 0) break;
+
+            size += static_cast<size_t>(n);
+            if (size == blob.size()) blob.resize(blob.size() * 2);
+        }
+        blob.resize(size);
+
+        return blob;
+    }
+
+    // 32-bit entry point "_SM_": major(6), minor(7)
+    // 64-bit entry point "_SM3_": major(7), minor(8), docrev(9)
+    static version_t entry_point_version(const std::vector<uint8_t>& ep)
+    {
+        if (ep.size() >= 10 && std::memcmp(ep.data(), "_SM3_", 5) == 0) {
+            return { .major = ep[7], .minor = ep[8], .patch = ep[9] };
+        }
+
+        if (ep.size() >= 8 && std::memcmp(ep.data(), "_SM_", 4) == 0) {
+            return { .major = ep[6], .minor = ep[7] };
+        }
+
         return {};
     }
+
+    smbios_t smbios(const std::string& dmi, const std::string& entry_point)
+    {
+        smbios_t smb{
+            .version = entry_point_version(read_blob(entry_point)),
+            .data    = read_blob(dmi),
+        };
+
+        for (const auto& structure : smb.view()) {
+            item_t item{
+                .type   = structure.type,
+                .length = static_cast<uint8_t>(structure.length - sizeof(header_t)),
+                .handle = structure.handle,
+                .fields = smb.data.data() + (structure.data - smb.data.data()) + sizeof(header_t),
+            };
+
+            for (auto str = structure.strings; str < structure.end && *str; str += std::strlen(str) + 1) {
+                item.strings.push_back(str);
+            }
+
+            smb.table.push_back(item);
+        }
+
+        return smb;
+    }
+
+    smbios_t smbios()
+    {
+        return smbios("/sys/firmware/dmi/tables/DMI", "/sys/firmware/dmi/tables/smbios_entry_point");
+    }
+
+    std::vector<uint8_t> structure_table() { return read_blob("/sys/firmware/dmi/tables/DMI"); }
 } // namespace probe::smbios
 
-#endif // __linux__
\ No newline at end of file
+#endif // __linux__
@@ -1,5 +1,6 @@
 #ifdef _WIN32
 
+#include "probe/defer.h"
 #include "probe/smbios.h"
 
 #include <Windows.h>
@@ -16,25 +17,38 @@ struct RawSMBIOSData
 
 namespace probe::smbios
 {
-    // https://www.dmtf.org/standards/smbios
-    smbios_t smbios()
+    // the version and the structure table of the raw SMBIOS firmware table
+    static bool read_rsmb(smbios_t& smb)
     {
         const auto rsmb_size = ::GetSystemFirmwareTable('RSMB', 0, nullptr, 0);
-        if (rsmb_size <= 0) return {};
+        if (rsmb_size <= 0) return false;
 
         const auto winrawsmb = static_cast<RawSMBIOSData *>(::HeapAlloc(::GetProcessHeap(), 0, rsmb_size));
-        if (winrawsmb == nullptr) return {};
+        if (winrawsmb == nullptr) return false;
+        defer(::HeapFree(::GetProcessHeap(), 0, winrawsmb));
 
-        if (::GetSystemFirmwareTable('RSMB', 0, winrawsmb, rsmb_size) != rsmb_size) return {};
+        if (::GetSystemFirmwareTable('RSMB', 0, winrawsmb, rsmb_size) != rsmb_size) return false;
 
-        smbios_t smb{};
         smb.version.major = winrawsmb->SMBIOSMajorVersion;
         smb.version.minor = winrawsmb->SMBIOSMinorVersion;
         smb.version.patch = winrawsmb->DmiRevision;
         smb.data.resize(winrawsmb->Length);
         ::memcpy(smb.data.data(), winrawsmb->SMBIOSTableData, winrawsmb->Length);
 
-        ::HeapFree(::GetProcessHeap(), 0, winrawsmb);
+        return true;
+    }
+
+    std::vector<uint8_t> structure_table()
+    {
+        smbios_t smb{};
+        return read_rsmb(smb) ? std::move(smb.data) : std::vector<uint8_t>{};
+    }
+
+    // https://www.dmtf.org/standards/smbios
+    smbios_t smbios()
+    {
+        smbios_t smb{};
+        if (!read_rsmb(smb)) return {};
 
         //
         for (size_t i = 0; i + sizeof(header_t) < smb.data.size();) {
@@ -2,7 +2,10 @@
 
 #include "probe/pciids.h"
 
+#include <algorithm>
+#include <functional>
 #include <regex>
+#include <string_view>
 
 namespace probe
 {
@@ -58,43 +61,108 @@ namespace probe
 
     bool strict_equal(const version_t& l, const version_t& r) { return l == r && l.codename == r.codename; }
 
+    // the pci.ids database generated by tools/pciids, sorted by the ids, and the vendor names case-folded
+    // and sorted by the names
+    // clang-format off
+#define V(ID, STR) ID,
+    static constexpr uint32_t vendor_ids[] = { PCIIDS_VENDORS };
+#undef V
+#define V(ID, STR) STR,
+    static constexpr const char *vendor_names[] = { PCIIDS_VENDORS };
+#undef V
+#define N(STR, ID) STR,
+    static constexpr std::string_view vendor_folded_names[] = { PCIIDS_VENDOR_NAMES };
+#undef N
+#define N(STR, ID) ID,
+    static constexpr uint32_t vendor_folded_ids[] = { PCIIDS_VENDOR_NAMES };
+#undef N
+#define P(ID, STR) ID,
+    static constexpr uint32_t product_ids[] = { PCIIDS_DEVICES };
+#undef P
+#define P(ID, STR) STR,
+    static constexpr const char *product_names[] = { PCIIDS_DEVICES };
+#undef P
+    // clang-format on
+
+    // strictly increasing
+    static_assert(std::ranges::adjacent_find(vendor_ids, std::ranges::greater_equal{}) ==
+                  std::end(vendor_ids));
+    static_assert(std::ranges::adjacent_find(product_ids, std::ranges::greater_equal{}) ==
+                  std::end(product_ids));
+    static_assert(std::ranges::adjacent_find(vendor_folded_names, std::ranges::greater_equal{}) ==
+                  std::end(vendor_folded_names));
+
+    // binary search, nullptr if not found
+    template<size_t N>
+    static const char *pciids_find(const uint32_t (&ids)[N], const char *const (&names)[N], uint32_t id)
+    {
+        const auto it = std::ranges::lower_bound(ids, id);
+        return (it != std::end(ids) && *it == id) ? names[it - std::begin(ids)] : nullptr;
+    }
+
     std::string vendor_cast(vendor_t vendor)
     {
-        // clang-format off
-        switch (static_cast<uint32_t>(vendor)) {
-#define V(ID, STR) case ID: return STR;
-        PCIIDS_VENDORS
-#undef V
-        default: return "Unknown";
+        const auto name = pciids_find(vendor_ids, vendor_names, static_cast<uint32_t>(vendor));
+        return name ? name : "Unknown";
+    }
+
+    // ASCII only, the same folding as tools/pciids
+    static char casefold(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+    static std::string casefold(std::string_view str)
+    {
+        std::string folded{ str };
+        for (auto& c : folded) c = casefold(c);
+        return folded;
+    }
+
+    static bool isword(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    // \bgenuineintel\b
+    static bool genuine_intel(std::string_view folded)
+    {
+        constexpr std::string_view word = "genuineintel";
+
+        for (auto pos = folded.find(word); pos != std::string_view::npos; pos = folded.find(word, pos + 1)) {
+            const auto end = pos + word.size();
+            if ((pos == 0 || !isword(folded[pos - 1])) && (end == folded.size() || !isword(folded[end])))
+                return true;
         }
-        // clang-format on
+        return false;
     }
 
     vendor_t vendor_cast(const std::string& name)
     {
-        if (std::regex_search(name, std::regex("\\bGenuineIntel\\b", std::regex_constants::icase)))
-            return vendor_t::Intel;
+        const auto folded = casefold(name);
 
-#define V(ID, STR)                                                                                         \
-    if (std::regex_match(STR, std::regex(name, std::regex_constants::icase)))                              \
-        return static_cast<vendor_t>(ID);
-        PCIIDS_VENDORS
-#undef V
+        if (genuine_intel(folded)) return vendor_t::Intel;
+
+        const auto it = std::ranges::lower_bound(vendor_folded_names, folded);
+        if (it != std::end(vendor_folded_names) && *it == folded)
+            return static_cast<vendor_t>(vendor_folded_ids[it - std::begin(vendor_folded_names)]);
 
         return vendor_t::Unknown;
     }
 
-    std::string product_name(uint32_t vid, uint32_t pid)
+    std::vector<vendor_t> vendors_by_prefix(const std::string& prefix)
     {
-        uint32_t key = (vid << 16) | pid;
-        // clang-format off
-        switch (key) {
-#define P(ID, STR) case ID: return STR;
-            PCIIDS_DEVICES
-#undef P
-        default: return {};
+        const auto folded = casefold(prefix);
+
+        std::vector<vendor_t> ret{};
+        for (auto it = std::ranges::lower_bound(vendor_folded_names, folded);
+             it != std::end(vendor_folded_names) && it->starts_with(folded); ++it) {
+            ret.emplace_back(static_cast<vendor_t>(vendor_folded_ids[it - std::begin(vendor_folded_names)]));
         }
-        // clang-format on
+        return ret;
+    }
+
+    std::string product_name(uint32_t vid, uint32_t pid)
+    {
+        const auto name = pciids_find(product_ids, product_names, (vid << 16) | pid);
+        return name ? name : std::string{};
     }
 
     std::string to_string(const version_t& ver)
@@ -109,60 +177,116 @@ namespace probe
         return vstr;
     }
 
+    static bool isseparator(char c) { return c == ' ' || c == '_' || c == '-'; }
+
+    // matches the pattern at str[pos], the pattern is a subset of the regex syntax:
+    //   \b       word boundary
+    //   [ _-]    one of ' ', '_' and '-'
+    //   [ _-]?   optional [ _-]
+    //   others   literal characters, case-insensitive
+    static bool bus_match(std::string_view str, size_t pos, std::string_view pattern)
+    {
+        while (!pattern.empty()) {
+            if (pattern.starts_with("\\b")) {
+                const auto before = pos > 0 && isword(str[pos - 1]);
+                const auto after  = pos < str.size() && isword(str[pos]);
+                if (before == after) return false;
+                pattern.remove_prefix(2);
+            }
+            else if (pattern.starts_with("[ _-]?")) {
+                pattern.remove_prefix(6);
+                if (pos < str.size() && isseparator(str[pos]) && bus_match(str, pos + 1, pattern)) return true;
+            }
+            else if (pattern.starts_with("[ _-]")) {
+                if (pos >= str.size() || !isseparator(str[pos])) return false;
+                pattern.remove_prefix(5);
+                ++pos;
+            }
+            else {
+                if (pos >= str.size() || casefold(str[pos]) != casefold(pattern[0])) return false;
+                pattern.remove_prefix(1);
+                ++pos;
+            }
+        }
+        return true;
+    }
+
+    // regex_search with '|' alternatives, without any allocation
+    static bool bus_search(std::string_view str, std::string_view pattern)
+    {
+        for (size_t begin = 0; begin <= pattern.size();) {
+            const auto end         = std::min(pattern.find('|', begin), pattern.size());
+            const auto alternative = pattern.substr(begin, end - begin);
+
+            for (size_t pos = 0; pos <= str.size(); ++pos) {
+                if (bus_match(str, pos, alternative)) return true;
+            }
+
+            begin = end + 1;
+        }
+        return false;
+    }
+
+    struct bus_pattern_t
+    {
+        std::string_view pattern;
+        bus_type_t       type;
+    };
+
+    // the first matched one wins
+    // clang-format off
+    static constexpr bus_pattern_t bus_patterns[] = {
+        { "\\bAC97\\b",                                                                             bus_type_t::AC97 },
+        { "\\bACPI\\b|Advanced[ _-]Configuration[ _-]and[ _-]Power[ _-]Interface",                 bus_type_t::ACPI },
+        { "\\bAuxiliary\\b",                                                                        bus_type_t::Auxiliary },
+        { "\\bATA\\b|Advanced[ _-]?Technology[ _-]?Attachment",                                     bus_type_t::ATA },
+        { "\\bCAN\\b|Controller[ _-]?Area[ _-]?Network",                                            bus_type_t::CAN },
+        { "\\bCEC\\b|Consumer[ _-]?Electronics[ _-]?Control",                                       bus_type_t::CEC },
+        { "\\bCPU\\b",                                                                              bus_type_t::CPU },
+        { "\\bEISA\\b|Extended[ _-]?ISA|Extended[ _-]?Industry[ _-]?Standard[ _-]?Architecture",    bus_type_t::EISA },
+        { "\\bFibre\\b",                                                                            bus_type_t::Fibre },
+        { "File[ _-]?Backed[ _-]?Virtual",                                                          bus_type_t::FileBackedVirtual },
+        { "\\bGPIO\\b|General[ _-]?Purpose[ _-]?Input/Output",                                      bus_type_t::GPIO },
+        { "HD[ _-]?Audio",                                                                          bus_type_t::HDAudio },
+        { "\\bID\\b|Human[ _-]?Interface[ _-]?Device",                                              bus_type_t::HID },
+        { "IEEE[ _-]?1394",                                                                         bus_type_t::IEEE1394 },
+        { "\\bI2C\\b|IIC|Inter[ _-]?Integrated[ _-]?Circuit",                                       bus_type_t::I2C },
+        { "\\bIDE\\b",                                                                              bus_type_t::IDE },
+        { "\\bISA\\b|Industry[ _-]?Standard[ _-]?Architecture",                                     bus_type_t::ISA },
+        { "\\biSCSI\\b|Internet[ _-]?Small[ _-]?Computer[ _-]?Systems[ _-]?Interface",              bus_type_t::iSCSI },
+        { "\\bMAX\\b",                                                                              bus_type_t::MAX },
+        { "\\bMDIO\\b|Management[ _-]?Data[ _-]?Input/Output",                                      bus_type_t::MDIO }, // also known as SMI/MIIM
+        { "\\bSMI\\b|Serial[ _-]?Management[ _-]?Interface",                                        bus_type_t::MDIO },
+        { "\\bMIIM\\b|Media[ _-]?Independent[ _-]?Interface Management",                            bus_type_t::MDIO },
+        { "\\bMMC\\b|Multi[ _-]Media[ _-]Card",                                                     bus_type_t::MMC },
+        { "\\bNVMEM\\b",                                                                            bus_type_t::NVMEM },
+        { "\\bNVMe\\b|NVMHCIS|NVM[ _-]?Express",                                                    bus_type_t::NVMe },
+        { "\\bPCI\\b|Peripheral[ _-]?Component[ _-]?Interconnect",                                  bus_type_t::PCI },
+        { "\\bPCI\\b[ _-]?e|PCI[ _-]?Express|Peripheral[ _-]?Component[ _-]?Interconnect[ _-]?Express", bus_type_t::PCIe },
+        { "\\bPnP\\b|Plug[ _-]?and[ _-]?Play",                                                      bus_type_t::PnP },
+        { "\\bRAID\\b",                                                                             bus_type_t::RAID },
+        { "\\bSAS\\b|Serial[ _-]?Attached[ _-]?SCSI",                                               bus_type_t::SAS },
+        { "\\bSATA\\b|Serial[ _-]?ATA|Serial[ _-]?AT[ _-]?Attachment",                              bus_type_t::SATA },
+        { "\\bSCM\\b",                                                                              bus_type_t::SCM },
+        { "\\bSCSI\\b",                                                                             bus_type_t::SCSI },
+        { "\\bSDIO\\b|\\bSD\\b",                                                                    bus_type_t::SDIO },
+        { "\\bSpaces\\b",                                                                           bus_type_t::Spaces },
+        { "\\bSPI\\b|Serial[ _-]Peripheral[ _-]Interface",                                          bus_type_t::SPI },
+        { "\\bSSA\\b|Serial[ _-]Storage[ _-]Architecture",                                          bus_type_t::SSA },
+        { "\\bUFS\\b|Universal[ _-]Flash[ _-]Storage",                                              bus_type_t::UFS },
+        { "\\bUSB\\b|Universal[ _-]Serial[ _-]Bus",                                                 bus_type_t::USB },
+        { "\\bVirtio\\b",                                                                           bus_type_t::Virtio },
+        { "\\bVirtual\\b",                                                                          bus_type_t::Virtual },
+        { "\\bVME\\b|Versa[ _-]Module[ _-]Eurocard",                                                bus_type_t::VME },
+        { "\\bXen\\b",                                                                              bus_type_t::Xen },
+    };
+    // clang-format on
+
     bus_type_t bus_cast(const std::string& str)
     {
-#define SEARCH_IF(REGEX, RES)                                                                              \
-    if (std::regex_search(                                                                                 \
-            str, std::regex(REGEX, std::regex_constants::ECMAScript | std::regex_constants::icase)))       \
-    return RES
-
-        SEARCH_IF("\\bAC97\\b", bus_type_t::AC97);
-        SEARCH_IF("\\bACPI\\b|Advanced[ _-]Configuration[ _-]and[ _-]Power[ _-]Interface", bus_type_t::ACPI);
-        SEARCH_IF("\\bAuxiliary\\b", bus_type_t::Auxiliary);
-        SEARCH_IF("\\bATA\\b|Advanced[ _-]?Technology[ _-]?Attachment", bus_type_t::ATA);
-        SEARCH_IF("\\bCAN\\b|Controller[ _-]?Area[ _-]?Network", bus_type_t::CAN);
-        SEARCH_IF("\\bCEC\\b|Consumer[ _-]?Electronics[ _-]?Control", bus_type_t::CEC);
-        SEARCH_IF("\\bCPU\\b", bus_type_t::CPU);
-        SEARCH_IF("\\bEISA\\b|Extended[ _-]?ISA|Extended[ _-]?Industry[ _-]?Standard[ _-]?Architecture",
-                  bus_type_t::EISA);
-        SEARCH_IF("\\bFibre\\b", bus_type_t::Fibre);
-        SEARCH_IF("File[ _-]?Backed[ _-]?Virtual", bus_type_t::FileBackedVirtual);
-        SEARCH_IF("\\bGPIO\\b|General[ _-]?Purpose[ _-]?Input/Output", bus_type_t::GPIO);
-        SEARCH_IF("HD[ _-]?Audio", bus_type_t::HDAudio);
-        SEARCH_IF("\\bID\\b|Human[ _-]?Interface[ _-]?Device", bus_type_t::HID);
-        SEARCH_IF("IEEE[ _-]?1394", bus_type_t::IEEE1394);
-        SEARCH_IF("\\bI2C\\b|IIC|Inter[ _-]?Integrated[ _-]?Circuit", bus_type_t::I2C);
-        SEARCH_IF("\\bIDE\\b", bus_type_t::IDE);
-        SEARCH_IF("\\bISA\\b|Industry[ _-]?Standard[ _-]?Architecture", bus_type_t::ISA);
-        SEARCH_IF("\\biSCSI\\b|Internet[ _-]?Small[ _-]?Computer[ _-]?Systems[ _-]?Interface", bus_type_t::iSCSI);
-        SEARCH_IF("\\bMAX\\b", bus_type_t::MAX);
-        SEARCH_IF("\\bMDIO\\b|Management[ _-]?Data[ _-]?Input/Output", bus_type_t::MDIO); // also known as SMI/MIIM
-        SEARCH_IF("\\bSMI\\b|Serial[ _-]?Management[ _-]?Interface", bus_type_t::MDIO);
-        SEARCH_IF("\\bMIIM\\b|Media[ _-]?Independent[ _-]?Interface Management", bus_type_t::MDIO);
-        SEARCH_IF("\\bMMC\\b|Multi[ _-]Media[ _-]Card", bus_type_t::MMC);
-        SEARCH_IF("\\bNVMEM\\b", bus_type_t::NVMEM);
-        SEARCH_IF("\\bNVMe\\b|NVMHCIS|NVM[ _-]?Express", bus_type_t::NVMe);
-        SEARCH_IF("\\bPCI\\b|Peripheral[ _-]?Component[ _-]?Interconnect", bus_type_t::PCI);
-        SEARCH_IF(
-            "\\bPCI\\b[ _-]?e|PCI[ _-]?Express|Peripheral[ _-]?Component[ _-]?Interconnect[ _-]?Express",
-            bus_type_t::PCIe);
-        SEARCH_IF("\\bPnP\\b|Plug[ _-]?and[ _-]?Play", bus_type_t::PnP);
-        SEARCH_IF("\\bRAID\\b", bus_type_t::RAID);
-        SEARCH_IF("\\bSAS\\b|Serial[ _-]?Attached[ _-]?SCSI", bus_type_t::SAS);
-        SEARCH_IF("\\bSATA\\b|Serial[ _-]?ATA|Serial[ _-]?AT[ _-]?Attachment", bus_type_t::SATA);
-        SEARCH_IF("\\bSCM\\b", bus_type_t::SCM);
-        SEARCH_IF("\\bSCSI\\b", bus_type_t::SCSI);
-        SEARCH_IF("\\bSDIO\\b|\\bSD\\b", bus_type_t::SDIO);
-        SEARCH_IF("\\bSpaces\\b", bus_type_t::Spaces);
-        SEARCH_IF("\\bSPI\\b|Serial[ _-]Peripheral[ _-]Interface", bus_type_t::SPI);
-        SEARCH_IF("\\bSSA\\b|Serial[ _-]Storage[ _-]Architecture", bus_type_t::SSA);
-        SEARCH_IF("\\bUFS\\b|Universal[ _-]Flash[ _-]Storage", bus_type_t::UFS);
-        SEARCH_IF("\\bUSB\\b|Universal[ _-]Serial[ _-]Bus", bus_type_t::USB);
-        SEARCH_IF("\\bVirtio\\b", bus_type_t::Virtio);
-        SEARCH_IF("\\bVirtual\\b", bus_type_t::Virtual);
-        SEARCH_IF("\\bVME\\b|Versa[ _-]Module[ _-]Eurocard", bus_type_t::VME);
-        SEARCH_IF("\\bXen\\b", bus_type_t::Xen);
-#undef SEARCH_IF
+        for (const auto& [pattern, type] : bus_patterns) {
+            if (bus_search(str, pattern)) return type;
+        }
         return bus_type_t::Unknown;
     }
 
@@ -1,17 +1,43 @@
 
 #ifdef __linux__
 
+#include "probe/defer.h"
 #include "probe/thread.h"
 #include "probe/util.h"
 
-#include <unistd.h>
-#include <cstring>
 #include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace probe::util
 {
     std::string format_system_error(uint64_t) { return {}; }
 
+    std::string_view read_at(int dirfd, const char *path, std::span<char> buffer)
+    {
+        const int fd = ::openat(dirfd, path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return {};
+        defer(::close(fd));
+
+        const auto size = ::read(fd, buffer.data(), buffer.size());
+        if (size <= 0) return {};
+
+        return { buffer.data(), static_cast<size_t>(size) };
+    }
+
+    std::string_view read_at(int dirfd, const char *path, std::span<char> buffer, std::string& overflow)
+    {
+        auto str = read_at(dirfd, path, buffer);
+        if (str.size() < buffer.size()) return str;
+
+        // may be truncated, the whole content is read again into a larger buffer
+        for (overflow.resize(buffer.size() * 2);; overflow.resize(overflow.size() * 2)) {
+            str = read_at(dirfd, path, overflow);
+            if (str.size() < overflow.size()) return str;
+        }
+    }
+
     std::pair<FILE *, pid_t> pipe_open(std::vector<const char *> cmd)
     {
         int pipefd[2]; // "r"+"w"
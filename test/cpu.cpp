@@ -0,0 +1,180 @@
+#include "probe/cpu.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace probe;
+
+TEST(CpusetTest, Parse)
+{
+    const auto set = cpu::to_cpuset("0-3,8,10-11,64");
+    EXPECT_EQ(set.count(), 8u);
+    EXPECT_TRUE(set.test(0));
+    EXPECT_TRUE(set.test(3));
+    EXPECT_FALSE(set.test(4));
+    EXPECT_TRUE(set.test(8));
+    EXPECT_TRUE(set.test(64));
+    EXPECT_FALSE(set.test(65));
+    EXPECT_FALSE(set.test(1'000));
+    EXPECT_EQ(set.cpus(), (std::vector<size_t>{ 0, 1, 2, 3, 8, 10, 11, 64 }));
+
+    EXPECT_TRUE(cpu::to_cpuset("").empty());
+    EXPECT_EQ(cpu::to_cpuset("5").cpus(), std::vector<size_t>{ 5 });
+}
+
+TEST(CpusetTest, Format)
+{
+    EXPECT_EQ(to_string(cpu::to_cpuset("0-3,8,10-11,64")), "0-3,8,10-11,64");
+    EXPECT_EQ(to_string(cpu::to_cpuset("1,2,3,5")), "1-3,5");
+    EXPECT_EQ(to_string(cpu::cpuset_t{}), "");
+}
+
+TEST(CpusetTest, Equal)
+{
+    auto set = cpu::to_cpuset("0-3,100");
+    EXPECT_EQ(set, cpu::to_cpuset("0-3,100"));
+
+    set.reset(100);
+    EXPECT_EQ(set.words.size(), 2u);
+    EXPECT_EQ(set, cpu::to_cpuset("0-3")); // the trailing zero words are ignored
+    EXPECT_FALSE(set == cpu::to_cpuset("0-4"));
+}
+
+#ifdef __linux__
+TEST(TopologyTest, Self)
+{
+    const auto  snapshot = cpu::topology();
+    const auto& topo     = *snapshot;
+    ASSERT_FALSE(topo.processors.empty());
+
+    EXPECT_EQ(topo.threads, topo.online.count());
+    EXPECT_EQ(topo.threads, std::thread::hardware_concurrency());
+    EXPECT_GE(topo.packages, 1u);
+    EXPECT_GE(topo.dies, topo.packages);
+    EXPECT_GE(topo.cores, topo.packages);
+    EXPECT_LE(topo.cores, topo.threads);
+    EXPECT_GE(topo.smt, 1u);
+
+    for (const auto& processor : topo.processors) {
+        EXPECT_TRUE(processor.siblings.test(processor.id));
+    }
+
+    const auto quantities = cpu::quantities();
+    EXPECT_EQ(quantities.logical, topo.threads);
+    EXPECT_EQ(quantities.physical, topo.cores);
+    EXPECT_EQ(quantities.packages, topo.packages);
+
+    // read again from sysfs
+    // shared until refreshed
+    EXPECT_EQ(cpu::topology(), snapshot);
+
+    const auto refreshed = cpu::topology(true);
+    EXPECT_NE(refreshed, snapshot);
+    EXPECT_EQ(refreshed->online, snapshot->online);
+    EXPECT_EQ(refreshed->processors.size(), snapshot->processors.size());
+    EXPECT_EQ(cpu::topology(), refreshed);
+}
+#endif
+
+#ifdef __linux__
+TEST(CacheTest, Shared)
+{
+    const auto caches = cpu::caches();
+    if (caches.empty()) GTEST_SKIP() << "no cache information in sysfs";
+
+    const auto online = cpu::topology()->online;
+
+    for (size_t i = 0; i < caches.size(); ++i) {
+        EXPECT_GT(caches[i].size, 0u);
+        EXPECT_FALSE(caches[i].shared.empty());
+        if (i > 0) {
+            EXPECT_LE(caches[i - 1].level, caches[i].level);
+        }
+
+        // each processor is covered once by the caches of the same level and type
+        for (size_t j = i + 1; j < caches.size(); ++j) {
+            if (caches[i].level != caches[j].level || caches[i].type != caches[j].type) continue;
+
+            for (const auto cpu : caches[i].shared.cpus()) EXPECT_FALSE(caches[j].shared.test(cpu));
+        }
+    }
+
+    cpu::cpuset_t covered{};
+    for (const auto& cache : cpu::cache(1, cpu::cache_type_t::data)) {
+        for (const auto cpu : cache.shared.cpus()) covered.set(cpu);
+    }
+    for (const auto cpu : online.cpus()) EXPECT_TRUE(covered.test(cpu));
+}
+#endif
+
+#ifdef __linux__
+TEST(SamplerTest, Self)
+{
+    cpu::sampler sampler{};
+    EXPECT_TRUE(sampler.sample().empty());
+
+    // burns for a while, so that the tick counts advance
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50)) {}
+
+    const auto& usages = sampler.sample();
+    EXPECT_EQ(usages.size(), cpu::topology()->online.count());
+
+    for (const auto& usage : usages) {
+        EXPECT_GE(usage.usage, 0.0);
+        EXPECT_LE(usage.usage, 100.0 + 1e-6);
+        EXPECT_NEAR(usage.user + usage.system + usage.irq + usage.steal, usage.usage, 1e-6);
+        EXPECT_LE(usage.usage + usage.iowait, 100.0 + 1e-6);
+    }
+}
+#endif
+
+TEST(FeatureTest, Set)
+{
+    constexpr cpu::feature_set_t set{ cpu::feature_t::sse2, cpu::feature_t::avx2 };
+    static_assert(set.has(cpu::feature_t::sse2));
+    static_assert(set.has(cpu::feature_t::avx2));
+    static_assert(!set.has(cpu::feature_t::avx));
+    static_assert(set.contains(cpu::feature_set_t{ cpu::feature_t::avx2 }));
+    static_assert(!set.contains(cpu::feature_set_t{ cpu::feature_t::avx }));
+    static_assert((set | cpu::feature_set_t{ cpu::feature_t::avx }).has(cpu::feature_t::avx));
+    static_assert(cpu::feature_set_t{}.empty());
+    static_assert(cpu::feature_index(cpu::feature_t::unknown) == -1);
+
+    // the snapshot agrees with the features reported by the vendor-filtered list
+    const auto& features = cpu::features();
+    for (const auto feature : cpu::instruction_sets()) {
+        EXPECT_TRUE(features.has(feature)) << to_string(feature);
+        EXPECT_TRUE(cpu::has(feature)) << to_string(feature);
+        EXPECT_TRUE(cpu::is_supported(feature)) << to_string(feature);
+    }
+
+    EXPECT_EQ(&cpu::features(), &features);
+    EXPECT_EQ(cpu::instruction_sets(), cpu::instruction_sets());
+}
+
+static int variant_avx512() { return 512; }
+static int variant_avx2() { return 2; }
+static int variant_scalar() { return 0; }
+
+TEST(DispatchTest, Select)
+{
+    using dispatch_t = cpu::dispatch<int()>;
+
+    constexpr cpu::feature_set_t avx2{ cpu::feature_t::avx, cpu::feature_t::avx2 };
+
+    const auto variants = { dispatch_t::variant_t{ { cpu::feature_t::avx512_f }, variant_avx512 },
+                            dispatch_t::variant_t{ avx2, variant_avx2 },
+                            dispatch_t::variant_t{ {}, variant_scalar } };
+
+    EXPECT_EQ(dispatch_t::select(variants, {}), &variant_scalar);
+    EXPECT_EQ(dispatch_t::select(variants, avx2), &variant_avx2);
+    EXPECT_EQ(dispatch_t::select(variants, avx2 | cpu::feature_set_t{ cpu::feature_t::avx512_f }),
+              &variant_avx512);
+    EXPECT_EQ(dispatch_t::select({ { avx2, variant_avx2 } }, {}), nullptr);
+
+    const dispatch_t dispatch{ { avx2, variant_avx2 }, { {}, variant_scalar } };
+    ASSERT_TRUE(dispatch);
+    EXPECT_EQ(dispatch(), cpu::features().contains(avx2) ? 2 : 0);
+}
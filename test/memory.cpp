@@ -0,0 +1,175 @@
+#include "probe/memory.h"
+
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace probe;
+
+TEST(MemoryTest, Status)
+{
+    const auto status = memory::status();
+    EXPECT_GT(status.total, 0u);
+    EXPECT_GT(status.avail, 0u);
+    EXPECT_LE(status.avail, status.total);
+}
+
+#ifdef __linux__
+TEST(MemoryTest, ParseMeminfo)
+{
+    constexpr auto meminfo = "MemTotal:        6147400 kB\n"
+                             "MemFree:         4875692 kB\n"
+                             "MemAvailable:    5512340 kB\n"
+                             "Buffers:           41232 kB\n"
+                             "Cached:           702164 kB\n"
+                             "SwapCached:            0 kB\n"
+                             "SwapTotal:       1048572 kB\n"
+                             "SwapFree:        1048000 kB\n"
+                             "Dirty:               120 kB\n"
+                             "Writeback:             8 kB\n"
+                             "Slab:             112344 kB\n"
+                             "SReclaimable:      61312 kB\n"
+                             "HugePages_Total:       4\n"
+                             "HugePages_Free:        3\n"
+                             "Hugepagesize:       2048 kB\n";
+
+    memory::memory_status_t status{};
+    ASSERT_TRUE(memory::parse_meminfo(meminfo, status));
+
+    EXPECT_EQ(status.total, 6147400ull * 1'024);
+    EXPECT_EQ(status.free, 4875692ull * 1'024);
+    EXPECT_EQ(status.avail, 5512340ull * 1'024);
+    EXPECT_EQ(status.buffers, 41232ull * 1'024);
+    EXPECT_EQ(status.cached, 702164ull * 1'024);
+    EXPECT_EQ(status.swap_total, 1048572ull * 1'024);
+    EXPECT_EQ(status.swap_free, 1048000ull * 1'024);
+    EXPECT_EQ(status.dirty, 120ull * 1'024);
+    EXPECT_EQ(status.writeback, 8ull * 1'024);
+    EXPECT_EQ(status.slab, 112344ull * 1'024);
+    EXPECT_EQ(status.slab_reclaimable, 61312ull * 1'024);
+    EXPECT_EQ(status.hugepages_total, 4u);
+    EXPECT_EQ(status.hugepages_free, 3u);
+    EXPECT_EQ(status.hugepage_size, 2048ull * 1'024);
+
+    // before Linux 3.14
+    memory::memory_status_t old{};
+    ASSERT_TRUE(memory::parse_meminfo("MemTotal: 100 kB\nMemFree: 10 kB\nBuffers: 1 kB\nCached: 20 kB\n", old));
+    EXPECT_EQ(old.avail, 31u * 1'024);
+
+    EXPECT_FALSE(memory::parse_meminfo("", old));
+}
+
+TEST(MemoryTest, ParsePressure)
+{
+    memory::memory_status_t status{};
+    ASSERT_TRUE(memory::parse_pressure("some avg10=1.50 avg60=0.25 avg300=0.00 total=123456\n"
+                                       "full avg10=0.75 avg60=0.10 avg300=0.01 total=6543\n",
+                                       status));
+
+    EXPECT_DOUBLE_EQ(status.some.avg10, 1.5);
+    EXPECT_DOUBLE_EQ(status.some.avg60, 0.25);
+    EXPECT_DOUBLE_EQ(status.some.avg300, 0.0);
+    EXPECT_EQ(status.some.total, 123456u);
+    EXPECT_DOUBLE_EQ(status.full.avg10, 0.75);
+    EXPECT_DOUBLE_EQ(status.full.avg300, 0.01);
+    EXPECT_EQ(status.full.total, 6543u);
+}
+#endif
+
+// appends a structure whose formatted area is the first `length` bytes of the header and the fields
+template<typename T>
+static void append(std::vector<uint8_t>& blob, smbios::type_t type, uint16_t handle, const T& fields,
+                   size_t length, std::initializer_list<std::string_view> strings)
+{
+    blob.insert(blob.end(), { static_cast<uint8_t>(type), static_cast<uint8_t>(length),
+                              static_cast<uint8_t>(handle & 0xff), static_cast<uint8_t>(handle >> 8) });
+
+    const auto bytes = reinterpret_cast<const uint8_t *>(&fields);
+    blob.insert(blob.end(), bytes, bytes + length - 4);
+
+    for (const auto str : strings) {
+        blob.insert(blob.end(), str.begin(), str.end());
+        blob.push_back(0);
+    }
+    if (strings.size() == 0) blob.push_back(0);
+    blob.push_back(0);
+}
+
+TEST(MemoryTest, Decode)
+{
+    std::vector<uint8_t> blob{};
+
+    smbios::PhysicalMemoryArray arr{
+        .Location                = 0x03,
+        .Use                     = 0x03,
+        .MemoryErrorCorrection   = 0x06,
+        .MaximumCapacity         = 0x8000'0000,
+        .NumberOfMemoryDevices   = 2,
+        .ExtendedMaximumCapacity = 2ull << 40,
+    };
+    append(blob, smbios::type_t::PhysicalMemoryArray, 0x1000, arr, 4 + sizeof(arr), {});
+
+    // SMBIOS 3.3, with the extended speeds
+    smbios::MemoryDevice dimm{
+        .PhysicalMemeoryArrayHandle     = 0x1000,
+        .TotalWidth                     = 72,
+        .DataWidth                      = 64,
+        .Size                           = 0x7fff,
+        .DeviceLocator                  = 1,
+        .BankLocator                    = 2,
+        .MemoryType                     = 0x22,
+        .Speed                          = 0xffff,
+        .Manufacturer                   = 3,
+        .PartNumber                     = 4,
+        .ExtendedSize                   = 64 * 1'024,
+        .ConfiguredMemeorySpeed         = 4'800,
+        .ConfiguredVoltage              = 1'100,
+        .ExtendedSpeed                  = 70'000,
+        .ExtendedConfiguredMemeorySpeed = 0,
+        .PMIC0ManufacturerID            = 0xffff, // 3.7+, beyond the length
+    };
+    append(blob, smbios::type_t::MemoryDevice, 0x1100, dimm,
+           4 + offsetof(smbios::MemoryDevice, PMIC0ManufacturerID),
+           { "DIMM 0", "P0 CHANNEL A", "Samsung", "M321R8GA0BB0-CQKZJ" });
+
+    // SMBIOS 2.3, in KB, an empty slot follows
+    smbios::MemoryDevice old{ .Size = 0x8000 | 512, .Speed = 2'400 };
+    append(blob, smbios::type_t::MemoryDevice, 0x1101, old, 4 + offsetof(smbios::MemoryDevice, Attributes), {});
+
+    smbios::MemoryDevice empty{ .Size = 0, .DeviceLocator = 1 };
+    append(blob, smbios::type_t::MemoryDevice, 0x1102, empty, 4 + offsetof(smbios::MemoryDevice, Speed),
+           { "DIMM 1" });
+
+    blob.insert(blob.end(), { 0x7f, 0x04, 0xff, 0xfe, 0x00, 0x00 });
+
+    const auto arrays = memory::physical_device_arrays(blob);
+    ASSERT_EQ(arrays.size(), 1u);
+    EXPECT_EQ(arrays[0].Handle, 0x1000);
+    EXPECT_EQ(arrays[0].Capacity, 2ull << 30); // KB
+    EXPECT_EQ(arrays[0].NumberOfMemoryDevices, 2);
+
+    const auto devices = memory::devices(blob);
+    ASSERT_EQ(devices.size(), 3u);
+
+    EXPECT_EQ(devices[0].Handle, 0x1100);
+    EXPECT_EQ(devices[0].PhysicalMemeoryArrayHandle, 0x1000);
+    EXPECT_EQ(devices[0].Size, 64ull << 30);
+    EXPECT_EQ(devices[0].DeviceLocator, "DIMM 0");
+    EXPECT_EQ(devices[0].BankLocator, "P0 CHANNEL A");
+    EXPECT_EQ(devices[0].Manufacturer, "Samsung");
+    EXPECT_EQ(devices[0].SerialNumber, "");
+    EXPECT_EQ(devices[0].PartNumber, "M321R8GA0BB0-CQKZJ");
+    EXPECT_EQ(devices[0].MemoryType, memory::memory_type_t::DDR5);
+    EXPECT_EQ(devices[0].Speed, 70'000u);
+    EXPECT_EQ(devices[0].ConfiguredSpeed, 4'800u);
+    EXPECT_EQ(devices[0].ConfiguredVoltage, 1'100);
+    EXPECT_EQ(devices[0].PMIC0ManufacturerID, 0);
+
+    EXPECT_EQ(devices[1].Size, 512ull * 1'024);
+    EXPECT_EQ(devices[1].Speed, 2'400u);
+    EXPECT_EQ(devices[1].ConfiguredSpeed, 0u);
+
+    EXPECT_EQ(devices[2].Size, 0u);
+    EXPECT_EQ(devices[2].DeviceLocator, "DIMM 1");
+    EXPECT_EQ(devices[2].Speed, 0u);
+}
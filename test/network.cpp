@@ -0,0 +1,276 @@
+#include "probe/network.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace probe;
+
+#ifdef __linux__
+// sends a few datagrams through the loopback interface
+static void loopback_traffic()
+{
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    ASSERT_GE(fd, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = htons(9);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    char payload[512]{};
+    for (int i = 0; i < 8; ++i) {
+        ::sendto(fd, payload, sizeof(payload), 0, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    }
+
+    ::close(fd);
+}
+
+TEST(NetworkTest, Adapters)
+{
+    const auto adapters = network::adapters();
+
+    // the same interfaces as if_nameindex(3)
+    const auto ifs = ::if_nameindex();
+    ASSERT_NE(ifs, nullptr);
+
+    size_t count = 0;
+    for (auto i = ifs; i->if_index != 0; ++i, ++count) {
+        EXPECT_NE(std::ranges::find(adapters, std::string{ i->if_name }, &network::adapter_t::name),
+                  adapters.end());
+    }
+    ::if_freenameindex(ifs);
+
+    EXPECT_EQ(adapters.size(), count);
+
+    const auto lo = std::ranges::find(adapters, std::string{ "lo" }, &network::adapter_t::name);
+    ASSERT_NE(lo, adapters.end());
+    EXPECT_EQ(lo->type, network::if_type_t::Loopback);
+    EXPECT_EQ(lo->physical_address, "00:00:00:00:00:00");
+    EXPECT_GT(lo->mtu, 0u);
+    if (lo->enabled) {
+        EXPECT_EQ(lo->ipv4_addresses, std::vector<std::string>{ "127.0.0.1" });
+    }
+}
+
+TEST(NetworkTest, Status)
+{
+    loopback_traffic();
+
+    const auto lo = network::status({ .name = "lo" });
+    EXPECT_EQ(lo.name, "lo");
+    EXPECT_GT(lo.index, 0u);
+    EXPECT_GT(lo.obytes, 0u);
+    EXPECT_GT(lo.opackets, 0u);
+
+    const auto none = network::status({ .name = "probe-none" });
+    EXPECT_EQ(none.index, 0u);
+}
+
+TEST(NetworkTest, Sampler)
+{
+    network::traffic_sampler sampler{};
+
+    EXPECT_TRUE(sampler.sample().empty());
+
+    loopback_traffic();
+
+    const auto& rates = sampler.sample();
+    const auto  lo    = std::ranges::find(rates, std::string{ "lo" }, &network::traffic_rate_t::name);
+    ASSERT_NE(lo, rates.end());
+    EXPECT_GT(lo->obytes, 0.0);
+    EXPECT_GT(lo->ibytes, 0.0);
+}
+
+TEST(NetworkTest, Sockets)
+{
+    // a listening TCP socket on an ephemeral port
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ASSERT_GE(fd, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len        = sizeof(addr);
+    ASSERT_EQ(::bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(fd, 16), 0);
+    ASSERT_EQ(::getsockname(fd, reinterpret_cast<sockaddr *>(&addr), &len), 0);
+
+    const auto port = ntohs(addr.sin_port);
+
+    const auto tcp = network::sockets({
+        .udp         = false,
+        .unix_domain = false,
+        .states      = 1 << static_cast<int>(network::socket_state_t::listen),
+        .local_port  = port,
+        .owners      = true,
+    });
+    ASSERT_EQ(tcp.size(), 1u);
+    EXPECT_EQ(tcp[0].protocol, network::socket_protocol_t::tcp);
+    EXPECT_EQ(tcp[0].state, network::socket_state_t::listen);
+    EXPECT_EQ(tcp[0].local_address, "127.0.0.1");
+    EXPECT_EQ(tcp[0].local_port, port);
+    EXPECT_EQ(tcp[0].wqueue, 16u);
+    EXPECT_EQ(tcp[0].pid, ::getpid());
+
+    // unix socket pair, matched by the inode
+    int pair[2]{};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair), 0);
+
+    struct stat st{};
+    ASSERT_EQ(::fstat(pair[0], &st), 0);
+
+    const auto unix_sockets = network::sockets({ .tcp = false, .udp = false });
+    const auto it           = std::ranges::find(unix_sockets, st.st_ino, &network::socket_t::inode);
+    ASSERT_NE(it, unix_sockets.end());
+    EXPECT_EQ(it->protocol, network::socket_protocol_t::unix_domain);
+    EXPECT_EQ(it->type, SOCK_STREAM);
+    EXPECT_NE(it->peer, 0u);
+
+    // streaming, stopped by the callback
+    size_t count = 0;
+    EXPECT_EQ(network::sockets({}, [&](const network::socket_t&) { return ++count < 1; }), 0);
+    EXPECT_EQ(count, 1u);
+
+    // all the dumps, the ones of the modules not loaded are skipped
+    EXPECT_EQ(network::sockets({}, [](const network::socket_t&) { return true; }), 0);
+
+    ::close(pair[0]);
+    ::close(pair[1]);
+    ::close(fd);
+}
+
+TEST(NetworkTest, Routes)
+{
+    const auto routes = network::routes();
+
+    network::route_table table{};
+    for (const auto& route : routes) {
+        EXPECT_TRUE(route.family == AF_INET || route.family == AF_INET6);
+        EXPECT_EQ(route.table, 254u);
+        EXPECT_TRUE(table.insert(route));
+
+        // the destination itself is matched by the route or a more specific one
+        const auto match = table.lookup(route.destination);
+        ASSERT_NE(match, nullptr);
+        EXPECT_GE(match->prefix, route.prefix);
+    }
+    EXPECT_EQ(table.size(), routes.size());
+}
+
+TEST(NetworkTest, RouteTable)
+{
+    const network::route_table table({
+        { .family = AF_INET, .destination = "0.0.0.0", .prefix = 0, .gateway = "192.0.2.1", .metric = 100 },
+        { .family = AF_INET, .destination = "0.0.0.0", .prefix = 0, .gateway = "192.0.2.254", .metric = 600 },
+        { .family = AF_INET, .destination = "10.0.0.0", .prefix = 8, .gateway = "192.0.2.10" },
+        { .family = AF_INET, .destination = "10.1.0.0", .prefix = 16, .name = "eth1" },
+        { .family = AF_INET, .destination = "10.1.2.3", .prefix = 32, .name = "tun0" },
+        { .family = AF_INET6, .destination = "fd00::", .prefix = 64, .name = "eth0" },
+        { .family = AF_INET6, .destination = "2001:db8::", .prefix = 32, .gateway = "fe80::1" },
+    });
+
+    EXPECT_EQ(table.lookup("8.8.8.8")->gateway, "192.0.2.1"); // the lower metric
+    EXPECT_EQ(table.lookup("10.200.0.1")->gateway, "192.0.2.10");
+    EXPECT_EQ(table.lookup("10.1.200.1")->name, "eth1");
+    EXPECT_EQ(table.lookup("10.1.2.3")->name, "tun0");
+    EXPECT_EQ(table.lookup("10.1.2.4")->name, "eth1");
+
+    EXPECT_EQ(table.lookup("fd00::1234")->name, "eth0");
+    EXPECT_EQ(table.lookup("2001:db8:1::1")->gateway, "fe80::1");
+    EXPECT_EQ(table.lookup("2001:db9::1"), nullptr); // no IPv6 default route
+
+    EXPECT_EQ(table.lookup("not an address"), nullptr);
+
+    const uint8_t address[4]{ 10, 1, 2, 3 };
+    EXPECT_EQ(table.lookup(AF_INET, address)->name, "tun0");
+}
+
+TEST(NetworkTest, ResolvConf)
+{
+    const auto resolver = network::parse_resolv_conf("# generated\n"
+                                                     "nameserver 192.0.2.53\n"
+                                                     "nameserver  2001:db8::53 # comment\n"
+                                                     "nameserver fe80::1%eth0\n"
+                                                     "domain corp.example\n"
+                                                     "search example.com example.net\n"
+                                                     "options edns0 trust-ad\n");
+
+    EXPECT_EQ(resolver.ipv4_servers, std::vector<std::string>{ "192.0.2.53" });
+    EXPECT_EQ(resolver.ipv6_servers, (std::vector<std::string>{ "2001:db8::53", "fe80::1%eth0" }));
+    EXPECT_EQ(resolver.search, (std::vector<std::string>{ "example.com", "example.net" }));
+}
+
+// moves the test process into a private network namespace, keep it the last one
+TEST(NetworkTest, Listener)
+{
+    using namespace std::chrono_literals;
+
+    if (::unshare(CLONE_NEWNET) < 0) GTEST_SKIP() << "requires CAP_SYS_ADMIN";
+
+    std::mutex                            mtx{};
+    std::condition_variable               cv{};
+    std::vector<network::adapter_event_t> events{};
+
+    network::NetlinkListener listener{};
+    ASSERT_EQ(listener.listen({},
+                              [&](const std::any& event) {
+                                  std::lock_guard lock(mtx);
+                                  events.emplace_back(std::any_cast<network::adapter_event_t>(event));
+                                  cv.notify_all();
+                              }),
+              0);
+    EXPECT_TRUE(listener.running());
+
+    const auto wait = [&](const auto& pred) {
+        std::unique_lock lock(mtx);
+        return cv.wait_for(lock, 2s, [&] { return std::ranges::any_of(events, pred); });
+    };
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    ASSERT_GE(fd, 0);
+
+    // ifup lo
+    ifreq ifr{};
+    std::strcpy(ifr.ifr_name, "lo");
+    ASSERT_EQ(::ioctl(fd, SIOCGIFFLAGS, &ifr), 0);
+    ifr.ifr_flags |= IFF_UP;
+    ASSERT_EQ(::ioctl(fd, SIOCSIFFLAGS, &ifr), 0);
+
+    EXPECT_TRUE(wait([](const auto& event) {
+        return event.type == network::adapter_event_type_t::changed && event.adapter.name == "lo" &&
+               event.adapter.enabled;
+    }));
+
+    // add an address to lo
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    ::inet_pton(AF_INET, "10.10.0.1", &addr.sin_addr);
+    std::memcpy(&ifr.ifr_addr, &addr, sizeof(addr));
+    ASSERT_EQ(::ioctl(fd, SIOCSIFADDR, &ifr), 0);
+
+    EXPECT_TRUE(wait([](const auto& event) {
+        return event.type == network::adapter_event_type_t::address_added && event.address == "10.10.0.1" &&
+               event.adapter.ipv4_addresses == std::vector<std::string>{ "10.10.0.1" };
+    }));
+
+    ::close(fd);
+
+    listener.stop();
+    EXPECT_FALSE(listener.running());
+}
+#endif
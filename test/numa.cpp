@@ -0,0 +1,99 @@
+#ifdef __linux__
+
+#include "probe/numa.h"
+#include "probe/thread.h"
+
+#include <cerrno>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace probe;
+
+TEST(NumaTest, Nodes)
+{
+    const auto nodes = numa::nodes();
+    if (!std::filesystem::exists("/sys/devices/system/node/online")) {
+        EXPECT_TRUE(nodes.empty());
+        GTEST_SKIP() << "the kernel is built without NUMA";
+    }
+
+    ASSERT_FALSE(nodes.empty());
+
+    const auto matrix = numa::distances();
+    ASSERT_EQ(matrix.size(), nodes.size());
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_GE(nodes[i].total, nodes[i].free);
+        EXPECT_EQ(nodes[i].distances, matrix[i]);
+
+        // the local distance
+        ASSERT_EQ(nodes[i].distances.size(), nodes.size());
+        EXPECT_EQ(nodes[i].distances[i], 10u);
+    }
+
+    // every online processor belongs to a node
+    const auto cpus = numa::cpu_nodes();
+    EXPECT_GE(cpus.size(), std::thread::hardware_concurrency());
+
+    for (const auto& node : nodes) {
+        for (const auto cpu : node.cpus.cpus()) {
+            EXPECT_EQ(numa::node_of(static_cast<uint32_t>(cpu)), static_cast<int32_t>(node.id));
+        }
+    }
+
+    EXPECT_EQ(numa::node_of(1'000'000), -1);
+}
+
+TEST(NumaTest, RunOnNode)
+{
+    const auto nodes = numa::nodes();
+    if (nodes.empty()) GTEST_SKIP() << "the kernel is built without NUMA";
+
+    std::thread([&] {
+        const auto& node = nodes.back();
+
+        ASSERT_EQ(numa::run_on_node(node.id), 0);
+        EXPECT_EQ(thread::affinity(), node.cpus);
+
+        std::this_thread::yield();
+        EXPECT_EQ(numa::current_node(), static_cast<int32_t>(node.id));
+    }).join();
+
+    EXPECT_NE(numa::run_on_node(1'000'000), 0);
+}
+
+TEST(NumaTest, BindMemory)
+{
+    const auto nodes = numa::nodes();
+    if (nodes.empty()) GTEST_SKIP() << "the kernel is built without NUMA";
+
+    std::thread([&] {
+        const auto result = numa::bind_memory(nodes.front().id);
+        if (result == EPERM || result == ENOSYS) GTEST_SKIP() << "set_mempolicy is not permitted";
+
+        ASSERT_EQ(result, 0);
+        EXPECT_EQ(numa::unbind_memory(), 0);
+    }).join();
+
+    EXPECT_NE(numa::bind_memory(1'000'000), 0);
+}
+
+TEST(ThreadTest, Affinity)
+{
+    std::thread([] {
+        const auto original = thread::affinity();
+        ASSERT_FALSE(original.empty());
+
+        cpu::cpuset_t first{};
+        first.set(original.cpus().front());
+
+        ASSERT_EQ(thread::set_affinity(first), 0);
+        EXPECT_EQ(thread::affinity(), first);
+
+        ASSERT_EQ(thread::set_affinity(original), 0);
+        EXPECT_EQ(thread::affinity(), original);
+    }).join();
+}
+
+#endif
@@ -0,0 +1,298 @@
+#ifdef __linux__
+
+#include "probe/process.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <gtest/gtest.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace probe::process;
+
+TEST(ParseStatTest, Fields)
+{
+    pstat_t s{};
+    EXPECT_TRUE(parse_stat_text("1234 (bash) S 1000 1234 1234 34816 5678 4194304 2375 19813 1 13 7 3 25 11 20 0 "
+                                "1 0 2658 12136448 1264 18446744073709551615 94358 95282 140727 0 0 0 65536 "
+                                "3686404 1266761467 1 0 0 17 3 0 0 5 0 0\n",
+                                s));
+
+    EXPECT_EQ(s.pid, 1234);
+    EXPECT_EQ(s.comm, "bash");
+    EXPECT_EQ(s.state, 'S');
+    EXPECT_EQ(s.ppid, 1000);
+    EXPECT_EQ(s.tty_nr, 34816);
+    EXPECT_EQ(s.minflt, 2375u);
+    EXPECT_EQ(s.utime, 7u);
+    EXPECT_EQ(s.stime, 3u);
+    EXPECT_EQ(s.priority, 20);
+    EXPECT_EQ(s.nice, 0);
+    EXPECT_EQ(s.nb_threads, 1);
+    EXPECT_EQ(s.starttime, 2658u);
+    EXPECT_EQ(s.vsize, 12136448u);
+    EXPECT_EQ(s.rss, 1264);
+    EXPECT_EQ(s.rsslim, 18446744073709551615ul);
+    EXPECT_EQ(s.wchan, 1u);
+    EXPECT_EQ(s.exit_signal, 17);
+    EXPECT_EQ(s.processor, 3);
+    EXPECT_EQ(s.blkio_ticks, 5u);
+}
+
+TEST(ParseStatTest, Comm)
+{
+    pstat_t s{};
+    EXPECT_TRUE(parse_stat_text("42 (a (b) c) R 1 42 42 0 -1 0 0 0 0 0 9 8 0 0 20 0 3 0 100 0 0 0 0 0 0 0 0 "
+                                "0 0 0 0 0",
+                                s));
+    EXPECT_EQ(s.pid, 42);
+    EXPECT_EQ(s.comm, "a (b) c");
+    EXPECT_EQ(s.state, 'R');
+    EXPECT_EQ(s.tpgid, -1);
+    EXPECT_EQ(s.utime, 9u);
+    EXPECT_EQ(s.nb_threads, 3);
+    EXPECT_EQ(s.starttime, 100u);
+
+    EXPECT_TRUE(parse_stat_text("43 () R 1 43 43 0 -1 0 0 0 0 0 9 8 0 0 20 0 3 0 100 0 0 0 0 0 0 0 0 0 0 0 0 0",
+                                s));
+    EXPECT_EQ(s.comm, "");
+
+    EXPECT_FALSE(parse_stat_text("", s));
+    EXPECT_FALSE(parse_stat_text("42 bash R", s));
+    EXPECT_FALSE(parse_stat_text("42 (bash) R 1 42 42 0 -1 0 0 0 0 0 9 8 0 0 20 0 3 0 100", s));
+}
+
+TEST(ParseStatTest, Self)
+{
+    char    buffer[1'024];
+    pstat_t s{};
+    EXPECT_TRUE(parse_stat(static_cast<uint64_t>(id()), s, buffer));
+    EXPECT_EQ(s.pid, id());
+    EXPECT_EQ(s.comm, parse_comm(id()));
+
+    EXPECT_FALSE(parse_stat(0, s, buffer));
+}
+
+TEST(ParseStatusTest, Fields)
+{
+    pstatus_t s{};
+    EXPECT_TRUE(parse_status_text("Name:\tmy app\n"
+                                  "Umask:\t0022\n"
+                                  "State:\tS (sleeping)\n"
+                                  "Tgid:\t1234\n"
+                                  "Ngid:\t0\n"
+                                  "Pid:\t1234\n"
+                                  "PPid:\t1000\n"
+                                  "TracerPid:\t0\n"
+                                  "Uid:\t1000\t1001\t1002\t1003\n"
+                                  "Gid:\t100\t101\t102\t103\n"
+                                  "FDSize:\t256\n"
+                                  "Groups:\t4 24 27 \n"
+                                  "NStgid:\t1234\t1\n"
+                                  "NSpid:\t1234\t1\n"
+                                  "VmPeak:\t   12000 kB\n"
+                                  "VmRSS:\t    5264 kB\n"
+                                  "Threads:\t4\n"
+                                  "SigQ:\t0/63429\n"
+                                  "SigBlk:\t0000000000010000\n"
+                                  "CapEff:\t000001ffffffffff\n"
+                                  "voluntary_ctxt_switches:\t150\n"
+                                  "nonvoluntary_ctxt_switches:\t7\n",
+                                  s));
+
+    EXPECT_EQ(s.name, "my app");
+    EXPECT_EQ(s.umask, 022u);
+    EXPECT_EQ(s.state, pstate_t::Sleeping);
+    EXPECT_EQ(s.tgid, 1234);
+    EXPECT_EQ(s.pid, 1234);
+    EXPECT_EQ(s.ppid, 1000);
+    EXPECT_EQ(s.ruid, 1000u);
+    EXPECT_EQ(s.euid, 1001u);
+    EXPECT_EQ(s.suid, 1002u);
+    EXPECT_EQ(s.fuid, 1003u);
+    EXPECT_EQ(s.rgid, 100u);
+    EXPECT_EQ(s.fgid, 103u);
+    EXPECT_EQ(s.fd_size, 256);
+    EXPECT_EQ(s.groups, "4 24 27 ");
+    EXPECT_EQ(s.nstgid, 1234);
+    EXPECT_EQ(s.vm_peak, 12000u);
+    EXPECT_EQ(s.vm_rss, 5264u);
+    EXPECT_EQ(s.vm_swap, 0u);
+    EXPECT_EQ(s.threads, 4);
+    EXPECT_EQ(s.sigblk, 0x10000u);
+    EXPECT_EQ(s.capeff, 0x1ffffffffffu);
+    EXPECT_EQ(s.voluntary_ctxt_switches, 150u);
+    EXPECT_EQ(s.nonvoluntary_ctxt_switches, 7u);
+
+    // missing keys are reset
+    EXPECT_TRUE(parse_status_text("Name:\tother\n", s));
+    EXPECT_EQ(s.name, "other");
+    EXPECT_EQ(s.pid, 0);
+    EXPECT_EQ(s.groups, "");
+    EXPECT_EQ(s.ruid, 0u);
+}
+
+TEST(ParseStatusTest, Self)
+{
+    const auto s = parse_status(static_cast<uint64_t>(id()));
+    EXPECT_EQ(s.pid, id());
+    EXPECT_EQ(s.name, parse_comm(id()));
+    EXPECT_EQ(s.ruid, ::getuid());
+    EXPECT_GE(s.threads, 1);
+}
+
+TEST(ParseStatusTest, SmallBuffer)
+{
+    // the status is read again into a larger buffer, the last lines are not lost
+    char      buffer[64];
+    pstatus_t s{};
+    EXPECT_TRUE(parse_status(static_cast<uint64_t>(id()), s, buffer));
+    EXPECT_EQ(s.pid, id());
+    EXPECT_EQ(s.ruid, ::getuid());
+    EXPECT_GE(s.threads, 1);
+}
+
+static bool contains(const std::vector<process_t>& list, int64_t pid)
+{
+    return std::ranges::any_of(list, [=](const auto& p) { return p.pid == pid; });
+}
+
+TEST(ProcessesTest, Threads)
+{
+    const auto list = processes();
+    EXPECT_TRUE(contains(list, id()));
+
+    for (const size_t nb_threads : { 0, 1, 2, 3, 64 }) {
+        const auto parallel = processes(nb_threads);
+        EXPECT_TRUE(contains(parallel, id()));
+        EXPECT_TRUE(std::ranges::is_sorted(parallel, {}, &process_t::pid));
+    }
+}
+
+TEST(ThreadsTest, Self)
+{
+    std::atomic<bool> running{ true };
+    std::atomic<long> tid{};
+    std::thread       worker([&] {
+        // named before the tid is published, the main thread reads the name once the tid is set
+        ::pthread_setname_np(::pthread_self(), "probe-worker");
+        tid = ::syscall(SYS_gettid);
+        while (running) std::this_thread::yield();
+    });
+    while (!tid) std::this_thread::yield();
+
+    std::vector<thread_t> list{};
+    EXPECT_TRUE(threads(static_cast<uint64_t>(id()), list));
+    EXPECT_GE(list.size(), 2u);
+    EXPECT_EQ(list.front().tid, static_cast<uint64_t>(id()));
+
+    const auto it = std::ranges::find(list, static_cast<uint64_t>(tid.load()), &thread_t::tid);
+    ASSERT_NE(it, list.end());
+    EXPECT_EQ(it->name, "probe-worker");
+    EXPECT_TRUE(it->state == 'R' || it->state == 'S'); // running, or sleeping while yielding
+
+    running = false;
+    worker.join();
+
+    // the elements are reused
+    const auto data = list.data();
+    EXPECT_TRUE(threads(static_cast<uint64_t>(id()), list));
+    EXPECT_EQ(list.data(), data);
+    EXPECT_EQ(std::ranges::find(list, static_cast<uint64_t>(tid.load()), &thread_t::tid), list.end());
+
+    EXPECT_FALSE(threads(0, list));
+}
+
+TEST(CpuSamplerTest, Self)
+{
+    cpu_sampler sampler{};
+    EXPECT_TRUE(sampler.sample().empty());
+
+    // busy for 200ms
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(200)) {
+    }
+
+    const auto& usages = sampler.sample();
+    const auto  it     = std::ranges::find(usages, id(), &cpu_usage_t::pid);
+    ASSERT_NE(it, usages.end());
+    EXPECT_GT(it->usage, 10.0);
+    EXPECT_DOUBLE_EQ(it->usage, it->user + it->system);
+    EXPECT_GE(it->minflt, 0.0);
+}
+
+TEST(SnapshotterTest, Delta)
+{
+    snapshotter snapshot{};
+
+    auto delta = snapshot.update();
+    EXPECT_TRUE(contains(delta.added, id()));
+    EXPECT_TRUE(delta.removed.empty());
+    EXPECT_EQ(snapshot.size(), delta.added.size());
+    EXPECT_TRUE(contains(snapshot.processes(), id()));
+
+    const auto child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        ::pause();
+        ::_exit(0);
+    }
+
+    delta = snapshot.update();
+    EXPECT_FALSE(contains(delta.added, id()));
+    EXPECT_TRUE(contains(delta.added, child));
+
+    ::kill(child, SIGKILL);
+    ::waitpid(child, nullptr, 0);
+
+    delta = snapshot.update();
+    EXPECT_TRUE(contains(delta.removed, child));
+    EXPECT_FALSE(contains(snapshot.processes(), child));
+}
+
+TEST(SnapshotterTest, Exec)
+{
+    int pipefd[2]{};
+    ASSERT_EQ(::pipe(pipefd), 0);
+
+    // forked, and exec(2)s once the snapshotter has seen it
+    const auto child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        char byte{};
+        ::close(pipefd[1]);
+        if (::read(pipefd[0], &byte, 1) == 1) ::execl("/bin/sleep", "sleep", "30", nullptr);
+        ::_exit(1);
+    }
+    ::close(pipefd[0]);
+
+    snapshotter snapshot{};
+    const auto  added  = snapshot.update().added;
+    const auto  forked = std::ranges::find(added, child, &process_t::pid);
+    ASSERT_NE(forked, added.end());
+    EXPECT_EQ(forked->name, parse_comm(id()));
+
+    ASSERT_EQ(::write(pipefd[1], "x", 1), 1);
+    ::close(pipefd[1]);
+
+    for (int i = 0; i < 500 && parse_comm(static_cast<uint64_t>(child)) != "sleep"; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    const auto delta = snapshot.update();
+    const auto it    = std::ranges::find(delta.changed, child, &process_t::pid);
+    ASSERT_NE(it, delta.changed.end());
+    EXPECT_EQ(it->name, "sleep");
+    EXPECT_TRUE(it->path.ends_with("sleep"));
+    EXPECT_TRUE(it->cmdline.starts_with("sleep"));
+    EXPECT_EQ(it->user, forked->user);
+
+    ::kill(child, SIGKILL);
+    ::waitpid(child, nullptr, 0);
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include "probe/smbios.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace probe;
+
+// BIOS (type 0) with two strings, a Memory Device (type 17) without strings and the End-of-Table
+static const std::vector<uint8_t> dmi = {
+    // type 0, length 0x0c, handle 0x0000
+    0x00, 0x0c, 0x00, 0x00, 0x01, 0x02, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00,
+    'V', 'e', 'n', 'd', 'o', 'r', 0x00, '1', '.', '0', 0x00, 0x00,
+    // type 17, length 0x15 (2.3), handle 0x1100
+    0x11, 0x15, 0x00, 0x11, 0x00, 0x10, 0xfe, 0xff, 0x48, 0x00, 0x40, 0x00, 0x00, 0x40, 0x09, 0x00, 0x01,
+    0x00, 0x1a, 0x80, 0x00,
+    0x00, 0x00,
+    // type 127, length 4, handle 0xfeff
+    0x7f, 0x04, 0xff, 0xfe, 0x00, 0x00,
+    // garbage after the End-of-Table
+    0xde, 0xad,
+};
+
+TEST(SmbiosTest, View)
+{
+    std::vector<smbios::structure_t> structures{};
+    for (const auto& structure : smbios::table_view{ dmi }) structures.push_back(structure);
+
+    ASSERT_EQ(structures.size(), 3u);
+
+    EXPECT_EQ(structures[0].type, smbios::type_t::BIOS);
+    EXPECT_EQ(structures[0].length, 0x0c);
+    EXPECT_EQ(structures[0].handle, 0x0000);
+    EXPECT_EQ(structures[0].string(1), "Vendor");
+    EXPECT_EQ(structures[0].string(2), "1.0");
+    EXPECT_EQ(structures[0].string(0), "");
+    EXPECT_EQ(structures[0].string(3), "");
+
+    EXPECT_EQ(structures[1].type, smbios::type_t::MemoryDevice);
+    EXPECT_EQ(structures[1].handle, 0x1100);
+    EXPECT_EQ(structures[1].string(1), "");
+
+    const auto device = structures[1].fields<smbios::MemoryDevice>();
+    EXPECT_EQ(device.PhysicalMemeoryArrayHandle, 0x1000);
+    EXPECT_EQ(device.TotalWidth, 72);
+    EXPECT_EQ(device.DataWidth, 64);
+    EXPECT_EQ(device.Size, 0x4000);
+    EXPECT_EQ(device.MemoryType, 0x1a);
+    EXPECT_EQ(device.Speed, 0u); // beyond the length
+    EXPECT_EQ(device.ExtendedSize, 0u);
+
+    EXPECT_EQ(structures[2].type, smbios::type_t::EndOfTable);
+
+    // truncated structures end the iteration
+    const std::vector<uint8_t> truncated(dmi.begin(), dmi.begin() + 30);
+    EXPECT_EQ(std::distance(smbios::table_view{ truncated }.begin(), smbios::table_view{ truncated }.end()), 1);
+    EXPECT_EQ(smbios::table_view{}.begin(), smbios::table_view{}.end());
+}
+
+#ifdef __linux__
+TEST(SmbiosTest, Dump)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "probe-smbios-test";
+    std::filesystem::create_directories(dir);
+
+    std::ofstream(dir / "DMI", std::ios::binary).write(reinterpret_cast<const char *>(dmi.data()), dmi.size());
+
+    // 64-bit entry point, SMBIOS 3.3.0
+    const char ep[24] = { '_', 'S', 'M', '3', '_', 0x00, 0x18, 0x03, 0x03, 0x00, 0x01 };
+    std::ofstream(dir / "smbios_entry_point", std::ios::binary).write(ep, sizeof(ep));
+
+    const auto smb = smbios::smbios((dir / "DMI").string(), (dir / "smbios_entry_point").string());
+    std::filesystem::remove_all(dir);
+
+    EXPECT_EQ(smb.version.major, 3u);
+    EXPECT_EQ(smb.version.minor, 3u);
+    EXPECT_EQ(smb.data, dmi);
+
+    ASSERT_EQ(smb.table.size(), 3u);
+    EXPECT_EQ(smb.table[0].type, smbios::type_t::BIOS);
+    EXPECT_EQ(smb.table[0].length, 0x0c - 4);
+    ASSERT_EQ(smb.table[0].strings.size(), 2u);
+    EXPECT_STREQ(smb.table[0].strings[0], "Vendor");
+    EXPECT_STREQ(smb.table[0].strings[1], "1.0");
+    EXPECT_EQ(smb.table[1].fields, smb.data.data() + 24 + 4);
+    EXPECT_TRUE(smb.table[1].strings.empty());
+
+    EXPECT_TRUE(smbios::smbios("/nonexistent", "/nonexistent").table.empty());
+}
+
+TEST(SmbiosTest, StructureTable)
+{
+    // the same blob, empty if /sys/firmware/dmi/tables is not readable
+    EXPECT_EQ(smbios::structure_table(), smbios::smbios().data);
+}
+#endif
@@ -0,0 +1,105 @@
+#include "probe/types.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+using namespace probe;
+
+TEST(PciidsTest, VendorName)
+{
+    EXPECT_EQ(vendor_cast(vendor_t::Intel), "Intel Corporation");
+    EXPECT_EQ(vendor_cast(vendor_t::NVIDIA), "NVIDIA Corporation");
+    EXPECT_EQ(vendor_cast(static_cast<vendor_t>(0x0001)), "SafeNet (wrong ID)"); // first
+    EXPECT_EQ(vendor_cast(static_cast<vendor_t>(0xffff)), "Illegal Vendor ID");  // last
+    EXPECT_EQ(vendor_cast(static_cast<vendor_t>(0x0000)), "Unknown");
+    EXPECT_EQ(vendor_cast(static_cast<vendor_t>(0x1234'5678)), "Unknown");
+}
+
+TEST(PciidsTest, ProductName)
+{
+    EXPECT_EQ(product_name(0x8086, 0x1533), "I210 Gigabit Network Connection");
+    EXPECT_EQ(product_name(0x10de, 0x1b80), "GP104 [GeForce GTX 1080]");
+    EXPECT_EQ(product_name(0x8086, 0x0000), "");
+    EXPECT_EQ(product_name(0x0000, 0x0000), "");
+}
+
+TEST(PciidsTest, VendorCast)
+{
+    EXPECT_EQ(vendor_cast("GenuineIntel"), vendor_t::Intel);
+    EXPECT_EQ(vendor_cast("genuineintel"), vendor_t::Intel);
+    EXPECT_EQ(vendor_cast("vendor: GenuineIntel."), vendor_t::Intel);
+    EXPECT_EQ(vendor_cast("GenuineIntelX"), vendor_t::Unknown);
+
+    // exact, case-insensitive
+    EXPECT_EQ(vendor_cast("Intel Corporation"), vendor_t::Intel);
+    EXPECT_EQ(vendor_cast("NVIDIA CORPORATION"), vendor_t::NVIDIA);
+    EXPECT_EQ(vendor_cast("nvidia corporation"), vendor_t::NVIDIA);
+    EXPECT_EQ(vendor_cast("NVIDIA"), vendor_t::Unknown);
+    EXPECT_EQ(vendor_cast("Intel Corporation "), vendor_t::Unknown);
+
+    // the smallest id wins if the names are the same
+    EXPECT_EQ(vendor_cast("Dell (wrong ID)"), static_cast<vendor_t>(0x0128));
+
+    EXPECT_EQ(vendor_cast(""), vendor_t::Unknown);
+    EXPECT_EQ(vendor_cast("AuthenticAMD"), vendor_t::Unknown);
+
+    // every vendor name maps back to itself, or to a smaller id with the same name
+    for (const auto id : { 0x0001u, 0x1002u, 0x10deu, 0x1414u, 0x17cbu, 0x8086u, 0xffffu }) {
+        const auto vendor = static_cast<vendor_t>(id);
+        EXPECT_LE(static_cast<uint32_t>(vendor_cast(vendor_cast(vendor))), id);
+        EXPECT_EQ(vendor_cast(vendor_cast(vendor_cast(vendor))), vendor_cast(vendor));
+    }
+}
+
+TEST(PciidsTest, VendorPrefix)
+{
+    const auto nvidia = vendors_by_prefix("nvidia");
+    EXPECT_FALSE(nvidia.empty());
+    EXPECT_NE(std::ranges::find(nvidia, vendor_t::NVIDIA), nvidia.end());
+    for (const auto vendor : nvidia) {
+        const auto name = vendor_cast(vendor);
+        EXPECT_EQ(vendors_by_prefix(name.substr(0, 6)), nvidia);
+    }
+
+    EXPECT_EQ(vendors_by_prefix("Intel Corporation"), std::vector<vendor_t>{ vendor_t::Intel });
+    EXPECT_TRUE(vendors_by_prefix("no such vendor prefix").empty());
+}
+
+TEST(BusCastTest, Names)
+{
+    // /sys/bus/<bus>/drivers
+    EXPECT_EQ(bus_cast("pci"), bus_type_t::PCI);
+    EXPECT_EQ(bus_cast("usb"), bus_type_t::USB);
+    EXPECT_EQ(bus_cast("scsi"), bus_type_t::SCSI);
+    EXPECT_EQ(bus_cast("virtio"), bus_type_t::Virtio);
+    EXPECT_EQ(bus_cast("nvme"), bus_type_t::NVMe);
+    EXPECT_EQ(bus_cast("acpi"), bus_type_t::ACPI);
+    EXPECT_EQ(bus_cast("i2c"), bus_type_t::I2C);
+    EXPECT_EQ(bus_cast("sdio"), bus_type_t::SDIO);
+    EXPECT_EQ(bus_cast("mmc"), bus_type_t::MMC);
+    EXPECT_EQ(bus_cast("xen"), bus_type_t::Xen);
+    EXPECT_EQ(bus_cast("platform"), bus_type_t::Unknown);
+    EXPECT_EQ(bus_cast(""), bus_type_t::Unknown);
+
+    // word boundaries, '_' is a word character
+    EXPECT_EQ(bus_cast("pci-0000:00:1f.2"), bus_type_t::PCI);
+    EXPECT_EQ(bus_cast("pci_express"), bus_type_t::PCIe);
+    EXPECT_EQ(bus_cast("pcie"), bus_type_t::Unknown);
+    EXPECT_EQ(bus_cast("PCI e"), bus_type_t::PCI); // the first matched one wins
+    EXPECT_EQ(bus_cast("usbhid"), bus_type_t::Unknown);
+    EXPECT_EQ(bus_cast("ide"), bus_type_t::IDE);
+    EXPECT_EQ(bus_cast("guide"), bus_type_t::Unknown);
+
+    // separators and case
+    EXPECT_EQ(bus_cast("Serial ATA"), bus_type_t::ATA); // the first matched one wins
+    EXPECT_EQ(bus_cast("serial-at_attachment"), bus_type_t::SATA);
+    EXPECT_EQ(bus_cast("SerialATA"), bus_type_t::SATA);
+    EXPECT_EQ(bus_cast("NVM Express"), bus_type_t::NVMe);
+    EXPECT_EQ(bus_cast("Universal Serial Bus"), bus_type_t::USB);
+    EXPECT_EQ(bus_cast("UniversalSerialBus"), bus_type_t::Unknown);
+    EXPECT_EQ(bus_cast("General Purpose Input/Output"), bus_type_t::GPIO);
+    EXPECT_EQ(bus_cast("Media Independent Interface Management"), bus_type_t::MDIO);
+    EXPECT_EQ(bus_cast("IEEE1394"), bus_type_t::IEEE1394);
+    EXPECT_EQ(bus_cast("FileBackedVirtual"), bus_type_t::FileBackedVirtual);
+    EXPECT_EQ(bus_cast("Virtual"), bus_type_t::Virtual);
+}
@@ -57,6 +57,15 @@ static std::optional<std::pair<std::string, std::string>> parse_device(const std
     return std::nullopt;
 }
 
+// ASCII only, the same folding as probe::vendor_cast(const std::string&)
+static std::string casefold(std::string str)
+{
+    for (auto& c : str) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return str;
+}
+
 #ifdef PARSE_SUBSYSTEMS
 static std::optional<std::tuple<std::string, std::string, std::string>>
 parse_subvendor(const std::string& str)
@@ -172,6 +181,18 @@ int main(int argc, char *argv[])
     }
     pcih << "\n";
 
+    // case-folded vendor names, sorted by the names, the smallest id wins if the names are the same
+    std::map<std::string, std::string> names{};
+    for (const auto& [k, v] : vendors) {
+        names.try_emplace(casefold(v), k);
+    }
+
+    pcih << "#define PCIIDS_VENDOR_NAMES \\\n";
+    for (const auto& [k, v] : names) {
+        pcih << "N(" << std::quoted(k) << ",0x" << v << ")\\\n";
+    }
+    pcih << "\n";
+
     // devices
     pcih << "#define PCIIDS_DEVICES \\\n";
     for (const auto& [k, v] : devices) {